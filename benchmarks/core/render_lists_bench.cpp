@@ -0,0 +1,96 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/cameras/perspective_camera.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/math/utilities.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <core/render_lists.hpp>
+
+#include <memory>
+
+namespace {
+
+// Lays `count` meshes out on a grid in front of the camera. Some fall outside
+// the frustum and every eighth mesh is transparent, so culling and both sorts
+// are exercised.
+auto make_scene(int count) {
+    auto scene = vglx::Scene::Create();
+    auto geometry = vglx::BoxGeometry::Create();
+    auto opaque = vglx::UnlitMaterial::Create();
+    auto transparent = vglx::UnlitMaterial::Create();
+    transparent->transparent = true;
+
+    for (auto i = 0; i < count; ++i) {
+        auto mesh = vglx::Mesh::Create(geometry, i % 8 == 0 ? transparent : opaque);
+        mesh->transform.SetPosition({
+            static_cast<float>(i % 100) - 50.0f,
+            static_cast<float>((i / 100) % 10) - 5.0f,
+            -static_cast<float>(i / 1000) * 4.0f - 2.0f
+        });
+        scene->Add(mesh);
+    }
+    return scene;
+}
+
+auto make_camera() {
+    return vglx::PerspectiveCamera::Create({
+        .fov = vglx::math::DegToRad(60.0f),
+        .aspect = 1.0f,
+        .near = 0.1f,
+        .far = 100.0f
+    });
+}
+
+}
+
+static auto RenderListsProcessScene(benchmark::State& state) -> void {
+    const auto count = static_cast<int>(state.range(0));
+    auto scene = make_scene(count);
+    auto camera = make_camera();
+    auto lists = vglx::RenderLists {state.range(1) != 0};
+
+    for (auto _ : state) {
+        scene->UpdateTransformHierarchy();
+        camera->UpdateViewMatrix();
+        lists.ProcessScene(scene.get(), camera.get());
+        benchmark::DoNotOptimize(lists.Opaque().data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(RenderListsProcessScene)
+    ->ArgNames({"meshes", "incremental"})
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({10000, 0})
+    ->Args({10000, 1});
+
+static auto RenderListsProcessMovingCamera(benchmark::State& state) -> void {
+    const auto count = static_cast<int>(state.range(0));
+    auto scene = make_scene(count);
+    auto camera = make_camera();
+    auto lists = vglx::RenderLists {state.range(1) != 0};
+    scene->Add(camera);
+
+    for (auto _ : state) {
+        camera->RotateY(0.01f);
+        scene->UpdateTransformHierarchy();
+        camera->UpdateViewMatrix();
+        lists.ProcessScene(scene.get(), camera.get());
+        benchmark::DoNotOptimize(lists.Opaque().data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(RenderListsProcessMovingCamera)
+    ->ArgNames({"meshes", "incremental"})
+    ->Args({10000, 0})
+    ->Args({10000, 1});
@@ -0,0 +1,27 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/geometries/sphere_geometry.hpp>
+#include <vglx/geometries/wireframe_geometry.hpp>
+
+static auto WireframeGeometryFromSphere(benchmark::State& state) -> void {
+    const auto segments = static_cast<unsigned>(state.range(0));
+    const auto sphere = vglx::SphereGeometry::Create({
+        .radius = 1.0f,
+        .width_segments = segments,
+        .height_segments = segments
+    });
+
+    for (auto _ : state) {
+        auto wireframe = vglx::WireframeGeometry::Create(sphere.get());
+        benchmark::DoNotOptimize(wireframe);
+    }
+    state.SetItemsProcessed(state.iterations() * sphere->IndexCount() / 3);
+}
+BENCHMARK(WireframeGeometryFromSphere)->Arg(32)->Arg(128);
@@ -0,0 +1,29 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/loaders/mesh_loader.hpp>
+
+#include <filesystem>
+
+static auto MeshLoaderLoad(benchmark::State& state) -> void {
+    const auto loader = vglx::MeshLoader::Create();
+    const auto path = std::filesystem::path {"assets/plane.msh"};
+    const auto bytes = std::filesystem::file_size(path);
+
+    for (auto _ : state) {
+        auto result = loader->Load(path);
+        if (!result) {
+            state.SkipWithError("Failed to load assets/plane.msh");
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+BENCHMARK(MeshLoaderLoad);
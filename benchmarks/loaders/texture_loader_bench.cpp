@@ -0,0 +1,29 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/loaders/texture_loader.hpp>
+
+#include <filesystem>
+
+static auto TextureLoaderLoad(benchmark::State& state) -> void {
+    const auto loader = vglx::TextureLoader::Create();
+    const auto path = std::filesystem::path {"assets/texture.tex"};
+    const auto bytes = std::filesystem::file_size(path);
+
+    for (auto _ : state) {
+        auto result = loader->Load(path);
+        if (!result) {
+            state.SkipWithError("Failed to load assets/texture.tex");
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+BENCHMARK(TextureLoaderLoad);
@@ -0,0 +1,104 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/math/box3.hpp>
+#include <vglx/math/frustum.hpp>
+#include <vglx/math/matrix4.hpp>
+#include <vglx/math/sphere.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Symmetric perspective projection, 60 degree fov, looking down -Z.
+auto make_frustum() {
+    constexpr auto f = 1.7320508f;
+    constexpr auto near = 0.1f;
+    constexpr auto far = 100.0f;
+    return vglx::Frustum {vglx::Matrix4 {
+        f, 0.0f, 0.0f, 0.0f,
+        0.0f, f, 0.0f, 0.0f,
+        0.0f, 0.0f, (far + near) / (near - far), 2.0f * far * near / (near - far),
+        0.0f, 0.0f, -1.0f, 0.0f
+    }};
+}
+
+// Roughly half of the spheres fall inside the frustum.
+auto make_spheres(std::size_t count) {
+    auto rng = std::mt19937 {42};
+    auto xy = std::uniform_real_distribution<float> {-60.0f, 60.0f};
+    auto z = std::uniform_real_distribution<float> {-120.0f, 20.0f};
+    auto output = std::vector<vglx::Sphere>(count);
+    for (auto& sphere : output) {
+        sphere = {{xy(rng), xy(rng), z(rng)}, 1.0f};
+    }
+    return output;
+}
+
+}
+
+static auto FrustumIntersectsWithSphere(benchmark::State& state) -> void {
+    const auto frustum = make_frustum();
+    const auto spheres = make_spheres(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto visible = 0;
+        for (const auto& sphere : spheres) {
+            visible += frustum.IntersectsWithSphere(sphere);
+        }
+        benchmark::DoNotOptimize(visible);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(FrustumIntersectsWithSphere)->Arg(10000);
+
+static auto FrustumIntersectsWithBox3(benchmark::State& state) -> void {
+    const auto frustum = make_frustum();
+    const auto spheres = make_spheres(static_cast<std::size_t>(state.range(0)));
+    auto boxes = std::vector<vglx::Box3> {};
+    boxes.reserve(spheres.size());
+    for (const auto& s : spheres) {
+        boxes.emplace_back(s.center - s.radius, s.center + s.radius);
+    }
+    for (auto _ : state) {
+        auto visible = 0;
+        for (const auto& box : boxes) {
+            visible += frustum.IntersectsWithBox3(box);
+        }
+        benchmark::DoNotOptimize(visible);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(FrustumIntersectsWithBox3)->Arg(10000);
+
+static auto FrustumCullSpheres(benchmark::State& state) -> void {
+    const auto frustum = make_frustum();
+    const auto spheres = make_spheres(static_cast<std::size_t>(state.range(0)));
+    const auto use_cache = state.range(1) != 0;
+    auto xs = std::vector<float> {};
+    auto ys = std::vector<float> {};
+    auto zs = std::vector<float> {};
+    auto rs = std::vector<float> {};
+    for (const auto& s : spheres) {
+        xs.push_back(s.center.x);
+        ys.push_back(s.center.y);
+        zs.push_back(s.center.z);
+        rs.push_back(s.radius);
+    }
+    auto visible = std::vector<uint32_t>((spheres.size() + 31) / 32);
+    auto cache = std::vector<uint8_t>(use_cache ? spheres.size() : 0);
+    for (auto _ : state) {
+        frustum.CullSpheres(xs, ys, zs, rs, visible, cache);
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(FrustumCullSpheres)->ArgNames({"count", "cache"})->Args({10000, 0})->Args({10000, 1});
@@ -0,0 +1,98 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/math/matrix4.hpp>
+#include <vglx/math/transform3.hpp>
+#include <vglx/math/vector3.hpp>
+
+#include <vector>
+
+namespace {
+
+auto make_matrix(float seed) {
+    auto t = vglx::Transform3 {};
+    t.SetPosition({seed, -seed * 0.5f, seed * 2.0f});
+    t.SetRotation(vglx::Euler {seed * 0.1f, seed * 0.2f, seed * 0.3f});
+    t.SetScale({1.0f + seed * 0.01f, 1.0f, 2.0f});
+    return t.Get();
+}
+
+auto make_matrices(std::size_t count) {
+    auto output = std::vector<vglx::Matrix4>(count);
+    for (auto i = 0uz; i < count; ++i) {
+        output[i] = make_matrix(static_cast<float>(i % 97));
+    }
+    return output;
+}
+
+}
+
+static auto Matrix4Multiply(benchmark::State& state) -> void {
+    auto a = make_matrix(1.0f);
+    auto b = make_matrix(2.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(a * b);
+    }
+}
+BENCHMARK(Matrix4Multiply);
+
+static auto Matrix4Inverse(benchmark::State& state) -> void {
+    auto m = make_matrix(3.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        benchmark::DoNotOptimize(vglx::Inverse(m));
+    }
+}
+BENCHMARK(Matrix4Inverse);
+
+static auto Matrix4BatchMultiply(benchmark::State& state) -> void {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto parent = make_matrix(4.0f);
+    const auto locals = make_matrices(count);
+    auto out = std::vector<vglx::Matrix4>(count);
+    for (auto _ : state) {
+        vglx::Multiply(parent, locals, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Matrix4BatchMultiply)->Arg(1024)->Arg(16384);
+
+static auto Matrix4BatchInverse(benchmark::State& state) -> void {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto mats = make_matrices(count);
+    auto out = std::vector<vglx::Matrix4>(count);
+    for (auto _ : state) {
+        vglx::Inverse(mats, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Matrix4BatchInverse)->Arg(1024)->Arg(16384);
+
+static auto Matrix4TransformPoints(benchmark::State& state) -> void {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto m = make_matrix(5.0f);
+    auto points = std::vector<vglx::Vector3>(count);
+    for (auto i = 0uz; i < count; ++i) {
+        points[i] = {static_cast<float>(i), 1.0f, -static_cast<float>(i)};
+    }
+    auto out = std::vector<vglx::Vector3>(count);
+    for (auto _ : state) {
+        vglx::TransformPoints(m, points, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Matrix4TransformPoints)->Arg(16384);
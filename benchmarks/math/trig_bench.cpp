@@ -0,0 +1,111 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/math/utilities.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr auto count = 4096uz;
+
+auto make_angles() {
+    auto output = std::vector<float>(count);
+    for (auto i = 0uz; i < count; ++i) {
+        output[i] = vglx::math::Lerp(-10.0f, 10.0f, static_cast<float>(i) / count);
+    }
+    return output;
+}
+
+}
+
+static auto SinCosStd(benchmark::State& state) -> void {
+    const auto x = make_angles();
+    auto sin = std::vector<float>(count);
+    auto cos = std::vector<float>(count);
+    for (auto _ : state) {
+        for (auto i = 0uz; i < count; ++i) {
+            sin[i] = std::sin(x[i]);
+            cos[i] = std::cos(x[i]);
+        }
+        benchmark::DoNotOptimize(sin.data());
+        benchmark::DoNotOptimize(cos.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(SinCosStd);
+
+static auto SinCosScalar(benchmark::State& state) -> void {
+    const auto x = make_angles();
+    auto sin = std::vector<float>(count);
+    auto cos = std::vector<float>(count);
+    for (auto _ : state) {
+        for (auto i = 0uz; i < count; ++i) {
+            sin[i] = vglx::math::Sin(x[i]);
+            cos[i] = vglx::math::Cos(x[i]);
+        }
+        benchmark::DoNotOptimize(sin.data());
+        benchmark::DoNotOptimize(cos.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(SinCosScalar);
+
+static auto SinCosArray(benchmark::State& state) -> void {
+    const auto x = make_angles();
+    auto sin = std::vector<float>(count);
+    auto cos = std::vector<float>(count);
+    for (auto _ : state) {
+        vglx::math::SinCos(x, sin, cos);
+        benchmark::DoNotOptimize(sin.data());
+        benchmark::DoNotOptimize(cos.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(SinCosArray);
+
+static auto AtanStd(benchmark::State& state) -> void {
+    const auto x = make_angles();
+    auto out = std::vector<float>(count);
+    for (auto _ : state) {
+        for (auto i = 0uz; i < count; ++i) out[i] = std::atan(x[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(AtanStd);
+
+static auto AtanScalar(benchmark::State& state) -> void {
+    const auto x = make_angles();
+    auto out = std::vector<float>(count);
+    for (auto _ : state) {
+        for (auto i = 0uz; i < count; ++i) out[i] = vglx::math::Atan(x[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(AtanScalar);
+
+static auto AtanArray(benchmark::State& state) -> void {
+    const auto x = make_angles();
+    auto out = std::vector<float>(count);
+    for (auto _ : state) {
+        vglx::math::Atan(x, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(AtanArray);
@@ -0,0 +1,95 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <vglx/nodes/node.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+enum class Shape { Wide, Deep, Tree };
+
+// Builds a hierarchy of roughly `count` nodes and returns the root along with
+// every node so the benchmark can touch them without walking the tree.
+auto make_hierarchy(Shape shape, int count, std::vector<vglx::Node*>& nodes) {
+    auto root = vglx::Node::Create();
+    nodes.push_back(root.get());
+
+    auto parents = std::vector<vglx::Node*> {root.get()};
+    for (auto i = 1; i < count; ++i) {
+        auto node = vglx::Node::Create();
+        node->transform.SetPosition({0.1f, 0.0f, 0.0f});
+        node->transform.SetRotation(vglx::Euler {0.0f, 0.01f * i, 0.0f});
+        nodes.push_back(node.get());
+
+        switch (shape) {
+            case Shape::Wide:
+                root->Add(node);
+                break;
+            case Shape::Deep:
+                nodes[i - 1]->Add(node);
+                break;
+            case Shape::Tree:
+                // Four children per parent, filled breadth first
+                nodes[(i - 1) / 4]->Add(node);
+                break;
+        }
+    }
+    return root;
+}
+
+auto update_hierarchy(benchmark::State& state, Shape shape) {
+    const auto count = static_cast<int>(state.range(0));
+    const auto dirty = state.range(1) != 0;
+    auto nodes = std::vector<vglx::Node*> {};
+    auto root = make_hierarchy(shape, count, nodes);
+    root->UpdateTransformHierarchy();
+
+    for (auto _ : state) {
+        if (dirty) {
+            state.PauseTiming();
+            for (auto* node : nodes) node->transform.touched = true;
+            state.ResumeTiming();
+        }
+        root->UpdateTransformHierarchy();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+}
+
+static auto NodeUpdateWideHierarchy(benchmark::State& state) -> void {
+    update_hierarchy(state, Shape::Wide);
+}
+BENCHMARK(NodeUpdateWideHierarchy)->ArgNames({"nodes", "dirty"})->Args({10000, 0})->Args({10000, 1});
+
+static auto NodeUpdateDeepHierarchy(benchmark::State& state) -> void {
+    update_hierarchy(state, Shape::Deep);
+}
+BENCHMARK(NodeUpdateDeepHierarchy)->ArgNames({"nodes", "dirty"})->Args({1000, 0})->Args({1000, 1});
+
+static auto NodeUpdateTreeHierarchy(benchmark::State& state) -> void {
+    update_hierarchy(state, Shape::Tree);
+}
+BENCHMARK(NodeUpdateTreeHierarchy)->ArgNames({"nodes", "dirty"})->Args({10000, 0})->Args({10000, 1});
+
+static auto NodeAnimatedTransforms(benchmark::State& state) -> void {
+    const auto count = static_cast<int>(state.range(0));
+    auto nodes = std::vector<vglx::Node*> {};
+    auto root = make_hierarchy(Shape::Tree, count, nodes);
+    root->UpdateTransformHierarchy();
+
+    for (auto _ : state) {
+        for (auto* node : nodes) node->RotateY(0.01f);
+        root->UpdateTransformHierarchy();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(NodeAnimatedTransforms)->Arg(10000);
@@ -0,0 +1,84 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <benchmark/benchmark.h>
+
+#include "mesh_converter.hpp"
+#include "texture_converter.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Writes a grid of `resolution` × `resolution` quads as an OBJ file with a
+// matching untextured material library.
+auto write_grid_obj(const fs::path& dir, int resolution) {
+    const auto obj_path = dir / ("grid_" + std::to_string(resolution) + ".obj");
+    const auto mtl_name = "grid_" + std::to_string(resolution) + ".mtl";
+
+    auto mtl = std::ofstream {dir / mtl_name};
+    mtl << "newmtl grid\nKd 0.8 0.8 0.8\n";
+
+    auto obj = std::ofstream {obj_path};
+    obj << "mtllib " << mtl_name << "\n";
+    const auto step = 1.0f / static_cast<float>(resolution);
+    for (auto y = 0; y <= resolution; ++y) {
+        for (auto x = 0; x <= resolution; ++x) {
+            obj << "v " << x * step << " " << y * step << " 0\n";
+            obj << "vt " << x * step << " " << y * step << "\n";
+        }
+    }
+    obj << "vn 0 0 1\nusemtl grid\n";
+    const auto row = resolution + 1;
+    for (auto y = 0; y < resolution; ++y) {
+        for (auto x = 0; x < resolution; ++x) {
+            const auto i = y * row + x + 1;
+            obj << "f " << i << "/" << i << "/1 "
+                << i + 1 << "/" << i + 1 << "/1 "
+                << i + row + 1 << "/" << i + row + 1 << "/1 "
+                << i + row << "/" << i + row << "/1\n";
+        }
+    }
+    return obj_path;
+}
+
+}
+
+static auto AssetBuilderConvertMesh(benchmark::State& state) -> void {
+    const auto dir = fs::temp_directory_path() / "vglx_benchmarks";
+    fs::create_directories(dir);
+    const auto input = write_grid_obj(dir, static_cast<int>(state.range(0)));
+    const auto output = fs::path {input}.replace_extension(".msh");
+
+    for (auto _ : state) {
+        if (auto result = convert_mesh(input, output); !result) {
+            state.SkipWithError(result.error().c_str());
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * fs::file_size(input));
+}
+BENCHMARK(AssetBuilderConvertMesh)->Arg(64)->Arg(256);
+
+static auto AssetBuilderConvertTexture(benchmark::State& state) -> void {
+    const auto input = fs::path {"assets/texture.png"};
+    const auto output = fs::temp_directory_path() / "vglx_benchmarks" / "texture.tex";
+    fs::create_directories(output.parent_path());
+
+    for (auto _ : state) {
+        if (auto result = convert_texture(input, output); !result) {
+            state.SkipWithError(result.error().c_str());
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * fs::file_size(input));
+}
+BENCHMARK(AssetBuilderConvertTexture);
@@ -2,10 +2,21 @@
 #
 # This module searches for GLSL files and converts them into C-style strings.
 # It makes a distinction between shaders and snippets. Snippets are used for
-# common code that is included across multiple shaders at runtime.
+# common code that is included across multiple shaders.
+#
+# Built-in shaders are preprocessed here so that program creation does not
+# have to: snippet includes are expanded in place, and the source is split at
+# `#pragma inject_attributes` into a preamble and a body. At runtime the
+# feature defines are written between the two. Snippets are still written on
+# their own because shader materials resolve their includes at runtime.
 
 file(GLOB_RECURSE SHADERS "**/*.vert" "**/*.frag" "**/*.glsl")
 
+# Regenerate the headers whenever a shader or snippet changes
+set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${SHADERS})
+
+set(INJECT_TOKEN "#pragma inject_attributes")
+
 foreach(SHADER IN LISTS SHADERS)
     get_filename_component(FILENAME ${SHADER} NAME)
     get_filename_component(DIRECTORY ${SHADER} DIRECTORY)
@@ -15,17 +26,44 @@ foreach(SHADER IN LISTS SHADERS)
     string(REGEX REPLACE "\\.[^.]*$" "" FILENAME_NO_EXT ${FILENAME})
     set(HEADER_FILE ${DIRECTORY}/headers/${FILENAME_NO_EXT}${EXT}.h)
 
+    file(READ ${SHADER} CONTENTS)
+
     string(FIND "${DIRECTORY}" "snippets" POSITION)
     if (POSITION GREATER -1)
         set(VAR "_SNIPPET_${FILENAME_NO_EXT}")
         message("🎨 Writing snippet ${FILENAME_NO_EXT}.h")
-    else()
-        set(VAR "_SHADER_${FILENAME_NO_EXT}${EXT}")
-        message("🎨 Writing shader ${FILENAME_NO_EXT}.h")
+
+        file(WRITE ${HEADER_FILE} "#pragma once\n\nstatic const char* ${VAR} = R\"(\n")
+        file(APPEND ${HEADER_FILE} "${CONTENTS}")
+        file(APPEND ${HEADER_FILE} "\n)\";")
+        continue()
     endif()
 
-    file(READ ${SHADER} CONTENTS)
-    file(WRITE ${HEADER_FILE} "#pragma once\n\nstatic const char* ${VAR} = R\"(\n")
-    file(APPEND ${HEADER_FILE} "${CONTENTS}")
-    file(APPEND ${HEADER_FILE} "\n)\";")
-endforeach()
\ No newline at end of file
+    set(VAR "_SHADER_${FILENAME_NO_EXT}${EXT}")
+    message("🎨 Writing shader ${FILENAME_NO_EXT}.h")
+
+    string(REGEX MATCHALL "#include \"snippets/[A-Za-z0-9_]+\\.glsl\"" INCLUDES "${CONTENTS}")
+    list(REMOVE_DUPLICATES INCLUDES)
+    foreach(INCLUDE IN LISTS INCLUDES)
+        string(REGEX REPLACE "#include \"(snippets/[A-Za-z0-9_]+\\.glsl)\"" "\\1" SNIPPET "${INCLUDE}")
+        set(SNIPPET_FILE ${DIRECTORY}/${SNIPPET})
+        if (NOT EXISTS ${SNIPPET_FILE})
+            message(FATAL_ERROR "${FILENAME} includes missing snippet ${SNIPPET}")
+        endif()
+        file(READ ${SNIPPET_FILE} SNIPPET_CONTENTS)
+        string(REPLACE "${INCLUDE}" "${SNIPPET_CONTENTS}" CONTENTS "${CONTENTS}")
+    endforeach()
+
+    string(FIND "${CONTENTS}" "${INJECT_TOKEN}" INJECT_POSITION)
+    if (INJECT_POSITION EQUAL -1)
+        message(FATAL_ERROR "The '${INJECT_TOKEN}' token is missing in ${FILENAME}")
+    endif()
+    string(LENGTH "${INJECT_TOKEN}" INJECT_LENGTH)
+    math(EXPR BODY_POSITION "${INJECT_POSITION} + ${INJECT_LENGTH}")
+    string(SUBSTRING "${CONTENTS}" 0 ${INJECT_POSITION} PREAMBLE)
+    string(SUBSTRING "${CONTENTS}" ${BODY_POSITION} -1 BODY)
+
+    file(WRITE ${HEADER_FILE} "#pragma once\n\n")
+    file(APPEND ${HEADER_FILE} "static const char* ${VAR}_preamble = R\"(\n${PREAMBLE})\";\n\n")
+    file(APPEND ${HEADER_FILE} "static const char* ${VAR} = R\"(${BODY}\n)\";")
+endforeach()
@@ -0,0 +1,420 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <vglx/vglx.hpp>
+
+#include "example_scene.hpp"
+
+#include "animation/example_animated_transform.hpp"
+#include "lighting/example_directional_light.hpp"
+#include "lighting/example_point_light.hpp"
+#include "lighting/example_spot_light.hpp"
+#include "materials/example_phong_material.hpp"
+#include "materials/example_shader_material.hpp"
+#include "materials/example_unlit_material.hpp"
+#include "rendering_effects/example_blending.hpp"
+#include "rendering_effects/example_fog.hpp"
+#include "sandbox/example_sandbox.hpp"
+#include "scene_features/example_debug_visuals.hpp"
+#include "scene_features/example_frustum_culling.hpp"
+#include "scene_features/example_mesh_instancing.hpp"
+#include "scene_features/example_model_loader.hpp"
+#include "scene_features/example_primitives.hpp"
+#include "scene_features/example_sprite.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numbers>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace vglx;
+
+namespace {
+
+struct BenchScene {
+    std::string_view name;
+    std::function<std::shared_ptr<ExampleScene>()> create;
+};
+
+template <class T>
+auto make() -> std::shared_ptr<ExampleScene> { return std::make_shared<T>(); }
+
+const auto bench_scenes = std::vector<BenchScene> {
+    {"sandbox", make<ExampleSandbox>},
+    {"unlit_material", make<ExampleUnlitMaterial>},
+    {"phong_material", make<ExamplePhongMaterial>},
+    {"shader_material", make<ExampleShaderMaterial>},
+    {"directional_light", make<ExampleDirectionalLight>},
+    {"point_light", make<ExamplePointLight>},
+    {"spot_light", make<ExampleSpotLight>},
+    {"blending", make<ExampleBlending>},
+    {"fog", make<ExampleFog>},
+    {"frustum_culling", make<ExampleFrustumCulling>},
+    {"mesh_instancing", make<ExampleMeshInstancing>},
+    {"model_loader", make<ExampleModelLoader>},
+    {"primitives", make<ExamplePrimitives>},
+    {"sprite", make<ExampleSprite>},
+    {"debug_visuals", make<ExampleDebugVisuals>},
+    {"animated_transform", make<ExampleAnimatedTransform>}
+};
+
+struct Options {
+    int frames {600};
+    int warmup {60};
+    int width {1024};
+    int height {768};
+    float timestep {1.0f / 60.0f};
+    std::string format {"json"};
+    std::string output;
+    std::vector<std::string> scenes;
+};
+
+struct Result {
+    std::string_view name;
+    Stats::Summary summary;
+    double render_time {0.0};
+    double draw_calls {0.0};
+    double triangles {0.0};
+    double program_binds {0.0};
+    double visible_objects {0.0};
+    double culled_objects {0.0};
+    bool gpu_available {false};
+};
+
+auto print_usage() {
+    std::cout <<
+        "Usage: vglx_bench [options]\n"
+        "  --frames <n>      Measured frames per scene (default 600)\n"
+        "  --warmup <n>      Frames rendered before measuring (default 60)\n"
+        "  --timestep <s>    Fixed simulation step in seconds (default 1/60)\n"
+        "  --size <w>x<h>    Framebuffer size (default 1024x768)\n"
+        "  --scene <name>    Run only this scene, may be repeated\n"
+        "  --format <fmt>    json or csv (default json)\n"
+        "  --output <path>   Write results to a file instead of stdout\n"
+        "  --list            Print the available scenes\n";
+}
+
+auto parse_number(std::string_view str, int& value) -> bool {
+    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    return ec == std::errc {} && ptr == str.data() + str.size();
+}
+
+// Floating-point std::from_chars is missing from older standard libraries.
+auto parse_number(const char* str, float& value) -> bool {
+    auto end = static_cast<char*>(nullptr);
+    value = std::strtof(str, &end);
+    return end != str && *end == '\0';
+}
+
+// Returns the exit code when the runner should stop without benchmarking.
+auto parse_options(int argc, char** argv, Options& options) -> std::optional<int> {
+    for (auto i = 1; i < argc; ++i) {
+        const auto arg = std::string_view {argv[i]};
+        if (arg == "--list") {
+            for (const auto& scene : bench_scenes) std::cout << scene.name << '\n';
+            return 0;
+        }
+        if (arg == "--help") {
+            print_usage();
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << arg << '\n';
+            print_usage();
+            return 1;
+        }
+
+        const auto value = std::string_view {argv[++i]};
+        auto valid = true;
+        if (arg == "--frames") {
+            valid = parse_number(value, options.frames) && options.frames > 0;
+        } else if (arg == "--warmup") {
+            valid = parse_number(value, options.warmup) && options.warmup >= 0;
+        } else if (arg == "--timestep") {
+            valid = parse_number(argv[i], options.timestep) && options.timestep > 0.0f;
+        } else if (arg == "--size") {
+            const auto x = value.find('x');
+            valid = x != std::string_view::npos &&
+                parse_number(value.substr(0, x), options.width) &&
+                parse_number(value.substr(x + 1), options.height);
+        } else if (arg == "--scene") {
+            options.scenes.emplace_back(value);
+        } else if (arg == "--format") {
+            options.format = value;
+            valid = value == "json" || value == "csv";
+        } else if (arg == "--output") {
+            options.output = value;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            std::cerr << "Invalid argument: " << arg << ' ' << value << '\n';
+            print_usage();
+            return 1;
+        }
+    }
+    return std::nullopt;
+}
+
+auto selected(const Options& options, std::string_view name) {
+    if (options.scenes.empty()) return true;
+    for (const auto& scene : options.scenes) {
+        if (scene == name) return true;
+    }
+    return false;
+}
+
+// Every example drives the camera with orbit controls, which place it at a
+// fixed point each update. The scripted path rotates that point around the
+// vertical axis and dollies in and out so that culling and overdraw vary over
+// the run, completing one orbit over the measured frames.
+auto apply_camera_path(Camera* camera, float t) {
+    const auto angle = t * 2.0f * std::numbers::pi_v<float>;
+    const auto dolly = 1.0f + 0.25f * std::sin(angle * 2.0f);
+    const auto p = camera->GetWorldPosition();
+    const auto c = std::cos(angle);
+    const auto s = std::sin(angle);
+    camera->transform.SetPosition(Vector3 {
+        p.x * c - p.z * s,
+        p.y,
+        p.x * s + p.z * c
+    } * dolly);
+    camera->LookAt(Vector3::Zero());
+}
+
+auto run_scene(
+    const Options& options,
+    const BenchScene& bench_scene,
+    Window& window,
+    Renderer& renderer,
+    Camera* camera,
+    SharedContext* context
+) -> Result {
+    auto scene = bench_scene.create();
+    scene->SetContext(context);
+
+    // Compile up front so that shader compilation does not land in warmup
+    // frames of scenes that are too short to absorb it.
+    renderer.Compile(scene.get(), camera);
+    while (renderer.PendingPrograms() > 0) {
+        std::this_thread::yield();
+    }
+
+    auto stats = Stats {{.capacity = static_cast<std::size_t>(options.frames)}};
+    auto result = Result {.name = bench_scene.name};
+
+    const auto total = options.warmup + options.frames;
+    for (auto frame = 0; frame < total; ++frame) {
+        const auto measuring = frame >= options.warmup;
+        if (frame == options.warmup) stats.Reset();
+
+        window.PollEvents();
+        scene->Advance(options.timestep);
+        if (measuring) {
+            const auto t = static_cast<float>(frame - options.warmup) / options.frames;
+            apply_camera_path(camera, t);
+        }
+
+        stats.BeforeRender();
+        renderer.Render(scene.get(), camera);
+        stats.RecordGPUTimings(renderer.GetGPUTimings());
+        stats.AfterRender(renderer.RenderedObjectsPerFrame());
+        window.SwapBuffers();
+
+        if (!measuring) continue;
+
+        const auto frame_stats = renderer.GetFrameStats();
+        result.draw_calls += frame_stats.draw_calls;
+        result.triangles += frame_stats.triangles;
+        result.program_binds += frame_stats.program_binds;
+        result.visible_objects += frame_stats.visible_objects;
+        result.culled_objects += frame_stats.culled_objects;
+        result.gpu_available |= renderer.GetGPUTimings().available;
+    }
+
+    const auto samples = stats.GetSamples();
+    for (const auto& sample : samples) result.render_time += sample.render_time;
+    if (!samples.empty()) result.render_time /= static_cast<double>(samples.size());
+
+    const auto frames = static_cast<double>(options.frames);
+    result.summary = stats.GetSummary();
+    result.draw_calls /= frames;
+    result.triangles /= frames;
+    result.program_binds /= frames;
+    result.visible_objects /= frames;
+    result.culled_objects /= frames;
+    return result;
+}
+
+auto to_json(const Options& options, const std::vector<Result>& results) -> std::string {
+    auto out = std::ostringstream {};
+    out << std::fixed << std::setprecision(3);
+    out << "{\n  \"frames\": " << options.frames
+        << ",\n  \"warmup\": " << options.warmup
+        << ",\n  \"timestep\": " << options.timestep
+        << ",\n  \"width\": " << options.width
+        << ",\n  \"height\": " << options.height
+        << ",\n  \"scenes\": [";
+
+    auto first = true;
+    for (const auto& r : results) {
+        const auto& s = r.summary;
+        out << (first ? "\n" : ",\n")
+            << "    {\"name\": \"" << r.name << '"'
+            << ", \"frames\": " << s.frames
+            << ", \"hitches\": " << s.hitches
+            << ", \"cpu_average_ms\": " << s.average
+            << ", \"cpu_p50_ms\": " << s.p50
+            << ", \"cpu_p95_ms\": " << s.p95
+            << ", \"cpu_p99_ms\": " << s.p99
+            << ", \"cpu_max_ms\": " << s.max
+            << ", \"render_average_ms\": " << r.render_time
+            << ", \"gpu_available\": " << (r.gpu_available ? "true" : "false")
+            << ", \"gpu_p50_ms\": " << s.gpu_p50
+            << ", \"gpu_p95_ms\": " << s.gpu_p95
+            << ", \"draw_calls\": " << r.draw_calls
+            << ", \"triangles\": " << r.triangles
+            << ", \"program_binds\": " << r.program_binds
+            << ", \"visible_objects\": " << r.visible_objects
+            << ", \"culled_objects\": " << r.culled_objects
+            << ", \"max_allocations\": " << s.max_allocations << '}';
+        first = false;
+    }
+
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+auto to_csv(const std::vector<Result>& results) -> std::string {
+    auto out = std::ostringstream {};
+    out << std::fixed << std::setprecision(3);
+    out << "name,frames,hitches,cpu_average_ms,cpu_p50_ms,cpu_p95_ms,cpu_p99_ms,cpu_max_ms,"
+        << "render_average_ms,gpu_available,gpu_p50_ms,gpu_p95_ms,"
+        << "draw_calls,triangles,program_binds,visible_objects,culled_objects,max_allocations\n";
+    for (const auto& r : results) {
+        const auto& s = r.summary;
+        out << r.name << ','
+            << s.frames << ','
+            << s.hitches << ','
+            << s.average << ','
+            << s.p50 << ','
+            << s.p95 << ','
+            << s.p99 << ','
+            << s.max << ','
+            << r.render_time << ','
+            << (r.gpu_available ? 1 : 0) << ','
+            << s.gpu_p50 << ','
+            << s.gpu_p95 << ','
+            << r.draw_calls << ','
+            << r.triangles << ','
+            << r.program_binds << ','
+            << r.visible_objects << ','
+            << r.culled_objects << ','
+            << s.max_allocations << '\n';
+    }
+    return out.str();
+}
+
+}
+
+auto main(int argc, char** argv) -> int {
+    auto options = Options {};
+    if (const auto exit_code = parse_options(argc, argv, options)) return *exit_code;
+
+    for (const auto& name : options.scenes) {
+        if (!std::ranges::any_of(bench_scenes, [&](const auto& s) { return s.name == name; })) {
+            std::cerr << "Unknown scene: " << name << '\n';
+            return 1;
+        }
+    }
+
+    auto window = Window {{
+        .title = "vglx_bench",
+        .width = options.width,
+        .height = options.height,
+        .antialiasing = 0,
+        .vsync = false,
+        .visible = false
+    }};
+    auto init_window = window.Initialize();
+    if (!init_window) {
+        std::cerr << init_window.error() << '\n';
+        return 1;
+    }
+
+    auto renderer = Renderer {{
+        .framebuffer_width = window.FramebufferWidth(),
+        .framebuffer_height = window.FramebufferHeight(),
+        .clear_color = 0x444444
+    }};
+    auto init_renderer = renderer.Initialize();
+    if (!init_renderer) {
+        std::cerr << init_renderer.error() << '\n';
+        return 1;
+    }
+
+    auto camera = PerspectiveCamera::Create({
+        .fov = math::DegToRad(60.0f),
+        .aspect = window.AspectRatio(),
+        .near = 0.1f,
+        .far = 1000.0f
+    });
+
+    auto context = std::make_unique<SharedContext>(
+        camera.get(),
+        window.AspectRatio(),
+        window.FramebufferWidth(),
+        window.FramebufferHeight(),
+        window.Width(),
+        window.Height()
+    );
+
+    auto results = std::vector<Result> {};
+    for (const auto& bench_scene : bench_scenes) {
+        if (!selected(options, bench_scene.name)) continue;
+        std::cerr << "Running " << bench_scene.name << "...\n";
+        results.emplace_back(run_scene(
+            options,
+            bench_scene,
+            window,
+            renderer,
+            camera.get(),
+            context.get()
+        ));
+    }
+
+    const auto report = options.format == "csv"
+        ? to_csv(results)
+        : to_json(options, results);
+
+    if (options.output.empty()) {
+        std::cout << report;
+        return 0;
+    }
+
+    auto file = std::ofstream {options.output, std::ios::binary};
+    file << report;
+    if (!file) {
+        std::cerr << "Failed to write results to " << options.output << '\n';
+        return 1;
+    }
+
+    return 0;
+}
@@ -12,7 +12,9 @@
 #include "vglx/cameras/camera.hpp"
 #include "vglx/math/color.hpp"
 #include "vglx/nodes/scene.hpp"
+#include "vglx/utilities/stats.hpp"
 
+#include <filesystem>
 #include <memory>
 #include <string>
 
@@ -87,6 +89,11 @@ public:
         int antialiasing {0}; ///< Antialiasing level (e.g., 4x MSAA).
         bool vsync {true}; ///< Enables vertical sync.
         bool show_stats {false}; ///< Show stats UI overlay.
+        bool incremental_render_lists {false}; ///< Maintain render lists across frames, see @ref Renderer::Parameters.
+        std::filesystem::path program_cache_directory {}; ///< Cache shader program binaries here, see @ref Renderer::Parameters.
+        bool parallel_shader_compile {true}; ///< Compile shader programs without blocking, see @ref Renderer::Parameters.
+        bool dynamic_light_count {false}; ///< Keep light counts out of shader programs, see @ref Renderer::Parameters.
+        std::filesystem::path stats_output {}; ///< Write frame statistics to this `.csv` or `.json` file on exit.
     };
 
     Application();
@@ -168,6 +175,14 @@ public:
      */
     [[nodiscard]] auto GetCamera() const -> Camera*;
 
+    /**
+     * @brief Returns the frame statistics collected by the runtime.
+     *
+     * Statistics are collected whether or not the overlay is shown, so they
+     * can be summarized or exported from @ref Update in unattended runs.
+     */
+    [[nodiscard]] auto GetStats() const -> Stats*;
+
     /**
      * @brief Sets the active scene.
      *
@@ -191,6 +206,8 @@ private:
 
     bool show_stats_ = false;
 
+    std::filesystem::path stats_output_;
+
     auto Setup() -> void;
     /// @endcond
 };
@@ -7,27 +7,30 @@
 
 #pragma once
 
-#include "vglx/math/utilities.hpp"
+#include "vglx_export.h"
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 
 namespace vglx {
 
 /// @cond INTERNAL
-class Identity {
+class VGLX_EXPORT Identity {
 public:
-    [[nodiscard]] const auto& UUID() const { return uuid_; }
+    [[nodiscard]] auto Id() const { return id_; }
 
     [[nodiscard]] const auto& Name() const { return name_; }
 
     auto SetName(std::string_view name) { name_ = name; }
 
+    [[nodiscard]] static auto NextId() -> uint64_t;
+
 private:
-    std::string uuid_ {math::GenerateUUID()};
+    uint64_t id_ {NextId()};
 
     std::string name_ {};
 };
 /// @endcond
 
-}
\ No newline at end of file
+}
@@ -13,6 +13,7 @@
 #include "vglx/math/color.hpp"
 #include "vglx/nodes/scene.hpp"
 
+#include <filesystem>
 #include <memory>
 #include <string>
 
@@ -55,6 +56,55 @@ public:
         int framebuffer_width; ///< Current framebuffer width in pixels.
         int framebuffer_height; ///< Current framebuffer height in pixels.
         Color clear_color; ///< Clear color used at the start of a frame.
+        bool incremental_render_lists {false}; ///< Maintain render lists across frames from scene change events.
+        std::filesystem::path program_cache_directory {}; ///< Store linked shader program binaries here and reuse them across runs. Empty disables the cache.
+        bool parallel_shader_compile {true}; ///< Compile new shader programs without blocking when the driver supports it; objects are skipped until their program is ready.
+        bool dynamic_light_count {false}; ///< Phong programs loop over the number of lights at runtime, so adding or removing lights does not compile new programs.
+    };
+
+    /**
+     * @brief Counters collected while rendering a frame.
+     *
+     * State change counters only count calls that reached the driver, so
+     * they reflect how well draws were batched rather than how many objects
+     * requested a binding. Work done between frames, such as @ref Compile or
+     * polling @ref PendingPrograms, is counted toward the next frame.
+     */
+    struct FrameStats {
+        size_t draw_calls {0}; ///< Draw calls of any kind.
+        size_t instanced_draws {0}; ///< Draw calls that rendered instanced meshes.
+        size_t instances {0}; ///< Instances submitted by instanced draws.
+        size_t triangles {0}; ///< Triangles submitted, counting every instance.
+        size_t vertices {0}; ///< Vertices submitted, counting every instance.
+        size_t program_binds {0}; ///< Shader program changes.
+        size_t vao_binds {0}; ///< Vertex array changes.
+        size_t texture_binds {0}; ///< Texture binding changes.
+        size_t uniform_uploads {0}; ///< Individual uniform uploads.
+        size_t object_uniform_writes {0}; ///< Per-object uniform blocks written to the uniform ring.
+        size_t buffer_upload_bytes {0}; ///< Bytes uploaded to vertex, index and instance buffers.
+        size_t texture_upload_bytes {0}; ///< Bytes uploaded to textures.
+        size_t shader_compilations {0}; ///< Shader programs compiled and linked.
+        size_t program_binary_loads {0}; ///< Shader programs restored from the program binary cache.
+        size_t pending_objects {0}; ///< Renderables skipped because their shader program was still compiling.
+        size_t visible_objects {0}; ///< Renderables that passed frustum culling.
+        size_t culled_objects {0}; ///< Renderables rejected by frustum culling.
+    };
+
+    /**
+     * @brief GPU time spent in each render phase, in milliseconds.
+     *
+     * Measured with timer queries that are read a few frames after they are
+     * issued, so the values lag the current frame slightly. Upload time is
+     * also included in the pass during which the upload happened.
+     */
+    struct GPUTimings {
+        double opaque {0.0}; ///< Opaque pass.
+        double transparent {0.0}; ///< Transparent pass.
+        double uploads {0.0}; ///< Geometry, instance and texture uploads.
+        double ui {0.0}; ///< UI pass marked by @ref BeginUIPass and @ref EndUIPass.
+        double total {0.0}; ///< Whole frame, including the UI pass.
+        size_t dropped_intervals {0}; ///< Upload intervals beyond the per-frame query budget, missing from `uploads`.
+        bool available {false}; ///< False until results arrive or when timer queries are unsupported.
     };
 
     /**
@@ -93,6 +143,33 @@ public:
      */
     auto Render(Scene* scene, Camera* camera) -> void;
 
+    /**
+     * @brief Starts compiling the shader programs needed to render a scene.
+     *
+     * Intended for loading screens, so that programs are not compiled the
+     * first time objects become visible. Every renderable in the scene is
+     * considered, including objects outside the camera frustum, using the
+     * lights currently in the scene. Adding or removing lights later may
+     * still require new programs.
+     *
+     * When parallel shader compilation is available this returns without
+     * waiting for the driver; poll @ref PendingPrograms to find out when
+     * compilation has finished. Otherwise the programs are ready on return.
+     *
+     * @param scene Pointer to the scene to prepare.
+     * @param camera Pointer to the camera the scene will be rendered from.
+     */
+    auto Compile(Scene* scene, Camera* camera) -> void;
+
+    /**
+     * @brief Returns the number of shader programs that are still compiling.
+     *
+     * Polls the driver, so calling it repeatedly while showing a loading
+     * screen is enough to make progress. Always zero without parallel
+     * shader compilation.
+     */
+    [[nodiscard]] auto PendingPrograms() -> size_t;
+
     /**
      * @brief Sets the active viewport rectangle in pixels.
      *
@@ -129,6 +206,36 @@ public:
      */
     [[nodiscard]] auto RenderedObjectsPerFrame() const -> size_t;
 
+    /**
+     * @brief Returns the counters collected during the last frame.
+     *
+     * Intended for telemetry and for spotting scenes that regress in
+     * batching, for example a rising number of program binds per draw call.
+     */
+    [[nodiscard]] auto GetFrameStats() const -> FrameStats;
+
+    /**
+     * @brief Returns the most recent GPU timings per render phase.
+     *
+     * Comparing @ref GPUTimings::total with the CPU frame time tells whether
+     * a frame is CPU or GPU bound.
+     */
+    [[nodiscard]] auto GetGPUTimings() const -> GPUTimings;
+
+    /**
+     * @brief Marks the start of UI rendering for GPU timing.
+     *
+     * UI is drawn outside of @ref Render, so callers that render a UI
+     * overlay wrap it with this call and @ref EndUIPass to have it measured.
+     * The runtime does this automatically.
+     */
+    auto BeginUIPass() -> void;
+
+    /**
+     * @brief Marks the end of UI rendering for GPU timing.
+     */
+    auto EndUIPass() -> void;
+
     virtual ~Renderer();
 
 private:
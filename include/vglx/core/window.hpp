@@ -77,6 +77,7 @@ public:
         int height; ///< Client-area height in pixels.
         int antialiasing; ///< Anti-aliasing sample count.
         bool vsync; ///< Enable or disable vertical sync.
+        bool visible {true}; ///< Show the window. Hidden windows still own a default framebuffer.
     };
 
     /**
@@ -36,6 +36,12 @@ namespace vglx {
  * name. Supported uniform types include scalar, vector, matrix, and color
  * values.
  *
+ * The renderer fills in per-object values such as `u_Model` and `u_Opacity`.
+ * Shaders that include `snippets/vert_global_params.glsl` or
+ * `snippets/frag_global_params.glsl` read them from the `ub_Object` uniform
+ * block. Shaders that declare them as plain uniforms, for example
+ * `uniform mat4 u_Model;`, receive them as regular uniforms instead.
+ *
  * @code
  * auto material = vglx::ShaderMaterial::Create({
  *   .vertex_shader = vert_source,
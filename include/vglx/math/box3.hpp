@@ -10,10 +10,13 @@
 #include "vglx_export.h"
 
 #include "vglx/math/matrix4.hpp"
+#include "vglx/math/simd.hpp"
+#include "vglx/math/utilities.hpp"
 #include "vglx/math/vector3.hpp"
 
-#include <array>
+#include <cassert>
 #include <limits>
+#include <span>
 
 namespace vglx {
 
@@ -103,25 +106,28 @@ struct VGLX_EXPORT Box3 {
      * @brief Applies a transform to the box.
      *
      * Computes the axis-aligned bounding box that encloses the transformed
-     * eight corners of the original box.
+     * box. The center is transformed as a point and the half-extent by the
+     * absolute values of the upper 3×3 part, which is equivalent to
+     * transforming all eight corners. Empty boxes are left unchanged.
      *
      * @param transform Transformation matrix to apply.
      */
     constexpr auto ApplyTransform(const Matrix4& transform) -> void {
-        std::array<Vector3, 8> points_ {};
+        if (IsEmpty()) return;
 
-        points_[0] = transform * Vector3 {min.x, min.y, min.z};
-        points_[1] = transform * Vector3 {min.x, min.y, max.z};
-        points_[2] = transform * Vector3 {min.x, max.y, min.z};
-        points_[3] = transform * Vector3 {min.x, max.y, max.z};
-        points_[4] = transform * Vector3 {max.x, min.y, min.z};
-        points_[5] = transform * Vector3 {max.x, min.y, max.z};
-        points_[6] = transform * Vector3 {max.x, max.y, min.z};
-        points_[7] = transform * Vector3 {max.x, max.y, max.z};
+        const auto center = transform * Center();
+        const auto extent = (max - min) * 0.5f;
 
-        Reset();
+        auto new_extent = Vector3 {};
+        for (auto i = 0; i < 3; ++i) {
+            new_extent[i] =
+                math::Fabs(transform(i, 0)) * extent.x +
+                math::Fabs(transform(i, 1)) * extent.y +
+                math::Fabs(transform(i, 2)) * extent.z;
+        }
 
-        for (const auto& point : points_) ExpandWithPoint(point);
+        min = center - new_extent;
+        max = center + new_extent;
     }
 
     /**
@@ -147,4 +153,126 @@ struct VGLX_EXPORT Box3 {
     }
 };
 
-}
\ No newline at end of file
+/**
+ * @brief Transforms many boxes by one matrix.
+ * @related Box3
+ *
+ * Batch form of @ref Box3::ApplyTransform. Empty boxes are copied through
+ * unchanged. `boxes` and `out` may alias.
+ *
+ * @param boxes Input boxes.
+ * @param transform Transformation matrix to apply.
+ * @param out Output boxes, same length as `boxes`.
+ */
+inline auto ApplyTransform(
+    std::span<const Box3> boxes,
+    const Matrix4& transform,
+    std::span<Box3> out
+) -> void {
+    assert(boxes.size() == out.size());
+#if defined(VGLX_SIMD)
+    const auto m = simd::LoadColumns(transform.Data());
+    const auto abs_m = simd::AbsColumns(m);
+    for (auto i = 0uz; i < boxes.size(); ++i) {
+        if (boxes[i].IsEmpty()) {
+            out[i] = boxes[i];
+        } else {
+            simd::TransformBox(
+                m, abs_m,
+                &boxes[i].min.x, &boxes[i].max.x,
+                &out[i].min.x, &out[i].max.x
+            );
+        }
+    }
+#else
+    for (auto i = 0uz; i < boxes.size(); ++i) {
+        out[i] = boxes[i];
+        out[i].ApplyTransform(transform);
+    }
+#endif
+}
+
+/**
+ * @brief Transforms boxes pairwise: `out[i]` is `boxes[i]` under `transforms[i]`.
+ * @related Box3
+ *
+ * @param boxes Input boxes.
+ * @param transforms Transformation matrices, same length as `boxes`.
+ * @param out Output boxes, same length as `boxes`.
+ */
+inline auto ApplyTransform(
+    std::span<const Box3> boxes,
+    std::span<const Matrix4> transforms,
+    std::span<Box3> out
+) -> void {
+    assert(boxes.size() == transforms.size() && boxes.size() == out.size());
+#if defined(VGLX_SIMD)
+    for (auto i = 0uz; i < boxes.size(); ++i) {
+        if (boxes[i].IsEmpty()) {
+            out[i] = boxes[i];
+        } else {
+            const auto m = simd::LoadColumns(transforms[i].Data());
+            const auto abs_m = simd::AbsColumns(m);
+            simd::TransformBox(
+                m, abs_m,
+                &boxes[i].min.x, &boxes[i].max.x,
+                &out[i].min.x, &out[i].max.x
+            );
+        }
+    }
+#else
+    for (auto i = 0uz; i < boxes.size(); ++i) {
+        out[i] = boxes[i];
+        out[i].ApplyTransform(transforms[i]);
+    }
+#endif
+}
+
+/**
+ * @brief Returns the union of one box transformed by each matrix.
+ * @related Box3
+ *
+ * Computes the bounds of every instance of `box` without materializing the
+ * intermediate boxes, which is the common case for instanced geometry.
+ *
+ * @param box Box to transform.
+ * @param transforms Transformation matrices.
+ * @return Enclosing box, or an empty box if `box` is empty or there are no transforms.
+ */
+[[nodiscard]] inline auto TransformedUnion(
+    const Box3& box,
+    std::span<const Matrix4> transforms
+) -> Box3 {
+    auto output = Box3 {};
+    if (box.IsEmpty() || transforms.empty()) return output;
+
+#if defined(VGLX_SIMD)
+    const auto c = box.Center();
+    const auto e = (box.max - box.min) * 0.5f;
+    auto lo = simd::Splat(std::numeric_limits<float>::max());
+    auto hi = simd::Splat(std::numeric_limits<float>::lowest());
+    for (const auto& transform : transforms) {
+        const auto m = simd::LoadColumns(transform.Data());
+        const auto center = simd::TransformPoint(m, c.x, c.y, c.z);
+        const auto extent = simd::TransformExtent(simd::AbsColumns(m), e.x, e.y, e.z);
+        lo = simd::Min(lo, simd::Sub(center, extent));
+        hi = simd::Max(hi, simd::Add(center, extent));
+    }
+
+    float min[4];
+    float max[4];
+    simd::Store(min, lo);
+    simd::Store(max, hi);
+    output.min = {min[0], min[1], min[2]};
+    output.max = {max[0], max[1], max[2]};
+#else
+    for (const auto& transform : transforms) {
+        auto transformed = box;
+        transformed.ApplyTransform(transform);
+        output.Union(transformed);
+    }
+#endif
+    return output;
+}
+
+}
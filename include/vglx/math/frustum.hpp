@@ -13,9 +13,13 @@
 #include "vglx/math/matrix4.hpp"
 #include "vglx/math/sphere.hpp"
 #include "vglx/math/plane.hpp"
+#include "vglx/math/simd.hpp"
 
 #include <algorithm>
 #include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
 
 namespace vglx {
 
@@ -137,6 +141,109 @@ public:
         });
     }
 
+    /**
+     * @brief Tests many spheres against the frustum at once.
+     *
+     * Spheres are given in structure-of-arrays form and tested several at a
+     * time using SIMD where available. Bit `i % 32` of `visible[i / 32]` is
+     * set when sphere `i` intersects the frustum and cleared otherwise.
+     *
+     * When `last_rejected` is provided, it caches the index of the plane that
+     * last rejected each sphere. That plane is tested first on the next call,
+     * which rejects objects that stay outside the view with a single plane
+     * test. Initialize the cache to zero and keep it with the sphere arrays.
+     *
+     * @param xs Sphere center X coordinates.
+     * @param ys Sphere center Y coordinates.
+     * @param zs Sphere center Z coordinates.
+     * @param rs Sphere radii.
+     * @param visible Output bitmask with at least `(xs.size() + 31) / 32` words.
+     * @param last_rejected Optional per-sphere plane cache, empty or `xs.size()` long.
+     */
+    auto CullSpheres(
+        std::span<const float> xs,
+        std::span<const float> ys,
+        std::span<const float> zs,
+        std::span<const float> rs,
+        std::span<uint32_t> visible,
+        std::span<uint8_t> last_rejected = {}
+    ) const -> void {
+        const auto count = xs.size();
+        const auto use_cache = !last_rejected.empty();
+        assert(ys.size() == count && zs.size() == count && rs.size() == count);
+        assert(visible.size() >= (count + 31) / 32);
+        assert(!use_cache || last_rejected.size() == count);
+
+        std::fill_n(visible.begin(), (count + 31) / 32, 0u);
+
+        auto i = 0uz;
+#if defined(VGLX_SIMD)
+        const auto zero = simd::Splat(0.0f);
+        for (; i + 4 <= count; i += 4) {
+            const auto x = simd::Load(&xs[i]);
+            const auto y = simd::Load(&ys[i]);
+            const auto z = simd::Load(&zs[i]);
+            const auto r = simd::Load(&rs[i]);
+
+            const auto distance = [&](auto nx, auto ny, auto nz, auto d) {
+                auto result = simd::MulAdd(nx, x, simd::Add(d, r));
+                result = simd::MulAdd(ny, y, result);
+                return simd::MulAdd(nz, z, result);
+            };
+
+            auto rejected = 0;
+            if (use_cache) {
+                alignas(16) float nx[4], ny[4], nz[4], d[4];
+                for (auto lane = 0; lane < 4; ++lane) {
+                    const auto& plane = planes_[last_rejected[i + lane] % 6];
+                    nx[lane] = plane.normal.x;
+                    ny[lane] = plane.normal.y;
+                    nz[lane] = plane.normal.z;
+                    d[lane] = plane.distance;
+                }
+                rejected = simd::LessThanMask(distance(
+                    simd::Load(nx), simd::Load(ny), simd::Load(nz), simd::Load(d)
+                ), zero);
+            }
+
+            for (auto p = 0; p < 6 && rejected != 0xF; ++p) {
+                const auto& plane = planes_[p];
+                const auto mask = simd::LessThanMask(distance(
+                    simd::Splat(plane.normal.x),
+                    simd::Splat(plane.normal.y),
+                    simd::Splat(plane.normal.z),
+                    simd::Splat(plane.distance)
+                ), zero) & ~rejected;
+
+                if (use_cache && mask != 0) {
+                    for (auto lane = 0; lane < 4; ++lane) {
+                        if (mask & (1 << lane)) last_rejected[i + lane] = static_cast<uint8_t>(p);
+                    }
+                }
+                rejected |= mask;
+            }
+
+            visible[i / 32] |= static_cast<uint32_t>(~rejected & 0xF) << (i % 32);
+        }
+#endif
+        for (; i < count; ++i) {
+            const auto center = Vector3 {xs[i], ys[i], zs[i]};
+            const auto outside = [&](int p) {
+                return planes_[p].DistanceToPoint(center) + rs[i] < 0.0f;
+            };
+
+            auto rejected = use_cache && outside(last_rejected[i] % 6);
+            for (auto p = 0; p < 6 && !rejected; ++p) {
+                if (outside(p)) {
+                    rejected = true;
+                    if (use_cache) last_rejected[i] = static_cast<uint8_t>(p);
+                }
+            }
+
+            if (!rejected) visible[i / 32] |= 1u << (i % 32);
+        }
+    }
+
 private:
     std::array<Plane, 6> planes_ = {};
 };
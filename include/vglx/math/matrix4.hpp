@@ -9,10 +9,14 @@
 
 #include "vglx_export.h"
 
+#include "vglx/math/simd.hpp"
 #include "vglx/math/vector3.hpp"
 #include "vglx/math/vector4.hpp"
 
 #include <array>
+#include <cassert>
+#include <span>
+#include <type_traits>
 
 namespace vglx {
 
@@ -148,10 +152,22 @@ public:
      */
     constexpr auto operator==(const Matrix4&) const -> bool = default;
 
+    /**
+     * @brief Returns a pointer to the 16 column-major elements.
+     */
+    [[nodiscard]] auto Data() -> float* { return &m[0].x; }
+
+    /**
+     * @brief Returns a pointer to the 16 column-major elements.
+     */
+    [[nodiscard]] auto Data() const -> const float* { return &m[0].x; }
+
 private:
     std::array<Vector4, 4> m;
 };
 
+static_assert(sizeof(Matrix4) == sizeof(float) * 16, "Matrix4 must be tightly packed");
+
 /**
  * @brief Multiplies two 4×4 matrices.
  * @related Matrix4
@@ -160,6 +176,13 @@ private:
  * @param b Right matrix.
  */
 [[nodiscard]] constexpr auto operator*(const Matrix4& a, const Matrix4& b) -> Matrix4 {
+#if defined(VGLX_SIMD)
+    if (!std::is_constant_evaluated()) {
+        auto output = Matrix4 {};
+        simd::MultiplyMatrix4(a.Data(), b.Data(), output.Data());
+        return output;
+    }
+#endif
     return Matrix4 {
         a(0, 0) * b(0, 0) + a(0, 1) * b(1, 0) + a(0, 2) * b(2, 0) + a(0, 3) * b(3, 0),
         a(0, 0) * b(0, 1) + a(0, 1) * b(1, 1) + a(0, 2) * b(2, 1) + a(0, 3) * b(3, 1),
@@ -246,6 +269,13 @@ private:
  * @param mat Input matrix.
  */
 [[nodiscard]] constexpr auto Inverse(const Matrix4& mat) -> Matrix4 {
+#if defined(VGLX_SIMD_SSE)
+    if (!std::is_constant_evaluated()) {
+        auto output = Matrix4 {};
+        simd::InverseMatrix4(mat.Data(), output.Data());
+        return output;
+    }
+#endif
     const auto& a = Vector3 {mat[0].x, mat[0].y, mat[0].z};
     const auto& b = Vector3 {mat[1].x, mat[1].y, mat[1].z};
     const auto& c = Vector3 {mat[2].x, mat[2].y, mat[2].z};
@@ -295,4 +325,125 @@ private:
     return output;
 }
 
-}
\ No newline at end of file
+/**
+ * @brief Multiplies pairs of matrices: `out[i] = a[i] * b[i]`.
+ * @related Matrix4
+ *
+ * @param a Left matrices.
+ * @param b Right matrices, same length as `a`.
+ * @param out Output matrices, same length as `a`.
+ */
+inline auto Multiply(
+    std::span<const Matrix4> a,
+    std::span<const Matrix4> b,
+    std::span<Matrix4> out
+) -> void {
+    assert(a.size() == b.size() && a.size() == out.size());
+    for (auto i = 0uz; i < a.size(); ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+/**
+ * @brief Multiplies one matrix by many: `out[i] = a * b[i]`.
+ * @related Matrix4
+ *
+ * Useful for composing a parent world transform with many local transforms.
+ *
+ * @param a Left matrix.
+ * @param b Right matrices.
+ * @param out Output matrices, same length as `b`.
+ */
+inline auto Multiply(
+    const Matrix4& a,
+    std::span<const Matrix4> b,
+    std::span<Matrix4> out
+) -> void {
+    assert(b.size() == out.size());
+#if defined(VGLX_SIMD)
+    const auto* lhs = a.Data();
+    for (auto i = 0uz; i < b.size(); ++i) {
+        simd::MultiplyMatrix4(lhs, b[i].Data(), out[i].Data());
+    }
+#else
+    for (auto i = 0uz; i < b.size(); ++i) {
+        out[i] = a * b[i];
+    }
+#endif
+}
+
+/**
+ * @brief Inverts many matrices: `out[i] = Inverse(mats[i])`.
+ * @related Matrix4
+ *
+ * @param mats Input matrices.
+ * @param out Output matrices, same length as `mats`.
+ */
+inline auto Inverse(std::span<const Matrix4> mats, std::span<Matrix4> out) -> void {
+    assert(mats.size() == out.size());
+    for (auto i = 0uz; i < mats.size(); ++i) {
+        out[i] = Inverse(mats[i]);
+    }
+}
+
+/**
+ * @brief Transforms many points by one matrix: `out[i] = transform * points[i]`.
+ * @related Matrix4
+ *
+ * Points are treated as positions (w = 1). `points` and `out` may alias.
+ *
+ * @param transform Affine transform to apply.
+ * @param points Input points.
+ * @param out Output points, same length as `points`.
+ */
+inline auto TransformPoints(
+    const Matrix4& transform,
+    std::span<const Vector3> points,
+    std::span<Vector3> out
+) -> void {
+    assert(points.size() == out.size());
+#if defined(VGLX_SIMD)
+    const auto m = simd::LoadColumns(transform.Data());
+    float result[4];
+    for (auto i = 0uz; i < points.size(); ++i) {
+        const auto& p = points[i];
+        simd::Store(result, simd::TransformPoint(m, p.x, p.y, p.z));
+        out[i] = {result[0], result[1], result[2]};
+    }
+#else
+    for (auto i = 0uz; i < points.size(); ++i) {
+        out[i] = transform * points[i];
+    }
+#endif
+}
+
+/**
+ * @brief Transforms points pairwise: `out[i] = transforms[i] * points[i]`.
+ * @related Matrix4
+ *
+ * @param transforms Affine transforms, same length as `points`.
+ * @param points Input points.
+ * @param out Output points, same length as `points`.
+ */
+inline auto TransformPoints(
+    std::span<const Matrix4> transforms,
+    std::span<const Vector3> points,
+    std::span<Vector3> out
+) -> void {
+    assert(transforms.size() == points.size() && points.size() == out.size());
+#if defined(VGLX_SIMD)
+    float result[4];
+    for (auto i = 0uz; i < points.size(); ++i) {
+        const auto& p = points[i];
+        const auto m = simd::LoadColumns(transforms[i].Data());
+        simd::Store(result, simd::TransformPoint(m, p.x, p.y, p.z));
+        out[i] = {result[0], result[1], result[2]};
+    }
+#else
+    for (auto i = 0uz; i < points.size(); ++i) {
+        out[i] = transforms[i] * points[i];
+    }
+#endif
+}
+
+}
@@ -0,0 +1,279 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include "vglx/math/euler.hpp"
+#include "vglx/math/matrix4.hpp"
+#include "vglx/math/utilities.hpp"
+#include "vglx/math/vector3.hpp"
+
+namespace vglx {
+
+/**
+ * @brief Unit quaternion representing a 3D rotation.
+ *
+ * Quaternion stores a rotation as `(x, y, z, w)` where `(x, y, z)` is the
+ * vector part and `w` is the scalar part. Unlike @ref Euler, composing and
+ * interpolating quaternions requires no trigonometry and does not suffer
+ * from gimbal lock, which makes them the preferred representation for
+ * animated transforms.
+ *
+ * Products follow the matrix convention: `a * b` applies `b` first, then `a`.
+ *
+ * @ingroup MathGroup
+ */
+class VGLX_EXPORT Quaternion {
+public:
+    float x {0.0f}; ///< X component of the vector part.
+    float y {0.0f}; ///< Y component of the vector part.
+    float z {0.0f}; ///< Z component of the vector part.
+    float w {1.0f}; ///< Scalar part.
+
+    /**
+     * @brief Constructs an identity quaternion.
+     */
+    constexpr Quaternion() = default;
+
+    /**
+     * @brief Constructs a quaternion from its components.
+     *
+     * @param x X component of the vector part.
+     * @param y Y component of the vector part.
+     * @param z Z component of the vector part.
+     * @param w Scalar part.
+     */
+    constexpr Quaternion(float x, float y, float z, float w) :
+        x(x),
+        y(y),
+        z(z),
+        w(w) {}
+
+    /**
+     * @brief Constructs a quaternion from Euler angles.
+     *
+     * Produces the same rotation as @ref Euler::GetMatrix.
+     *
+     * @param euler Euler angles in radians.
+     */
+    explicit constexpr Quaternion(const Euler& euler) {
+        const auto half_p = euler.pitch * 0.5f;
+        const auto half_y = euler.yaw * 0.5f;
+        const auto half_r = euler.roll * 0.5f;
+        const auto qx = Quaternion {math::Sin(half_p), 0.0f, 0.0f, math::Cos(half_p)};
+        const auto qy = Quaternion {0.0f, math::Sin(half_y), 0.0f, math::Cos(half_y)};
+        const auto qz = Quaternion {0.0f, 0.0f, math::Sin(half_r), math::Cos(half_r)};
+        *this = qz * qx * qy;
+    }
+
+    /**
+     * @brief Constructs a quaternion from the rotation part of a matrix.
+     *
+     * The upper 3×3 part of the matrix must be orthonormal.
+     *
+     * @param m Input rotation matrix.
+     */
+    explicit constexpr Quaternion(const Matrix4& m) {
+        const auto trace = m(0, 0) + m(1, 1) + m(2, 2);
+        if (trace > 0.0f) {
+            const auto s = 0.5f / math::Sqrt(trace + 1.0f);
+            w = 0.25f / s;
+            x = (m(2, 1) - m(1, 2)) * s;
+            y = (m(0, 2) - m(2, 0)) * s;
+            z = (m(1, 0) - m(0, 1)) * s;
+        } else if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2)) {
+            const auto s = 2.0f * math::Sqrt(1.0f + m(0, 0) - m(1, 1) - m(2, 2));
+            w = (m(2, 1) - m(1, 2)) / s;
+            x = 0.25f * s;
+            y = (m(0, 1) + m(1, 0)) / s;
+            z = (m(0, 2) + m(2, 0)) / s;
+        } else if (m(1, 1) > m(2, 2)) {
+            const auto s = 2.0f * math::Sqrt(1.0f + m(1, 1) - m(0, 0) - m(2, 2));
+            w = (m(0, 2) - m(2, 0)) / s;
+            x = (m(0, 1) + m(1, 0)) / s;
+            y = 0.25f * s;
+            z = (m(1, 2) + m(2, 1)) / s;
+        } else {
+            const auto s = 2.0f * math::Sqrt(1.0f + m(2, 2) - m(0, 0) - m(1, 1));
+            w = (m(1, 0) - m(0, 1)) / s;
+            x = (m(0, 2) + m(2, 0)) / s;
+            y = (m(1, 2) + m(2, 1)) / s;
+            z = 0.25f * s;
+        }
+    }
+
+    /**
+     * @brief Returns the identity quaternion.
+     */
+    [[nodiscard]] static constexpr auto Identity() { return Quaternion {}; }
+
+    /**
+     * @brief Creates a rotation around an arbitrary axis.
+     *
+     * @param axis Normalized rotation axis.
+     * @param angle Rotation angle in radians.
+     */
+    [[nodiscard]] static constexpr auto FromAxisAngle(const Vector3& axis, float angle) {
+        const auto s = math::Sin(angle * 0.5f);
+        return Quaternion {axis.x * s, axis.y * s, axis.z * s, math::Cos(angle * 0.5f)};
+    }
+
+    /**
+     * @brief Returns the conjugate, which is the inverse of a unit quaternion.
+     */
+    [[nodiscard]] constexpr auto Conjugate() const {
+        return Quaternion {-x, -y, -z, w};
+    }
+
+    /**
+     * @brief Computes the squared length of the quaternion.
+     */
+    [[nodiscard]] constexpr auto LengthSquared() const {
+        return x * x + y * y + z * z + w * w;
+    }
+
+    /**
+     * @brief Normalizes the quaternion in place.
+     *
+     * Repeated composition accumulates rounding error, so quaternions that
+     * are updated every frame should be renormalized periodically.
+     */
+    constexpr auto Normalize() -> void {
+        const auto len_sq = LengthSquared();
+        if (len_sq == 0.0f) {
+            *this = Identity();
+            return;
+        }
+        const auto inv_len = math::InverseSqrt(len_sq);
+        x *= inv_len;
+        y *= inv_len;
+        z *= inv_len;
+        w *= inv_len;
+    }
+
+    /**
+     * @brief Converts the rotation to Euler angles.
+     *
+     * The result uses the same YXZ convention as @ref Euler and is subject
+     * to the same gimbal lock limitations.
+     */
+    [[nodiscard]] constexpr auto GetEuler() const -> Euler {
+        return Euler {GetMatrix()};
+    }
+
+    /**
+     * @brief Converts the rotation into a 4×4 rotation matrix.
+     */
+    [[nodiscard]] constexpr auto GetMatrix() const -> Matrix4 {
+        const auto xx = x * x, yy = y * y, zz = z * z;
+        const auto xy = x * y, xz = x * z, yz = y * z;
+        const auto wx = w * x, wy = w * y, wz = w * z;
+
+        return Matrix4 {
+            1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz), 2.0f * (xz + wy), 0.0f,
+            2.0f * (xy + wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx), 0.0f,
+            2.0f * (xz - wy), 2.0f * (yz + wx), 1.0f - 2.0f * (xx + yy), 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
+        };
+    }
+
+    /**
+     * @brief Checks whether the quaternion is the identity rotation.
+     */
+    [[nodiscard]] constexpr auto IsIdentity() const -> bool {
+        return x == 0.0f && y == 0.0f && z == 0.0f && w == 1.0f;
+    }
+
+    /**
+     * @brief Compares two quaternions for component-wise equality.
+     */
+    constexpr auto operator==(const Quaternion&) const -> bool = default;
+
+    /// @brief Composes two rotations.
+    [[nodiscard]] friend constexpr auto operator*(const Quaternion& a, const Quaternion& b) -> Quaternion {
+        return Quaternion {
+            a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+            a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+            a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+            a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+        };
+    }
+
+    /// @brief Rotates a vector.
+    [[nodiscard]] friend constexpr auto operator*(const Quaternion& q, const Vector3& v) -> Vector3 {
+        const auto u = Vector3 {q.x, q.y, q.z};
+        const auto t = Cross(u, v) * 2.0f;
+        return v + t * q.w + Cross(u, t);
+    }
+};
+
+/**
+ * @brief Computes the dot product between two quaternions.
+ * @relatesalso Quaternion
+ *
+ * @param a First quaternion.
+ * @param b Second quaternion.
+ * @return float Dot product.
+ */
+[[nodiscard]] inline constexpr auto Dot(const Quaternion& a, const Quaternion& b) -> float {
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+/**
+ * @brief Returns a normalized copy of the given quaternion.
+ * @relatesalso Quaternion
+ *
+ * @param q Input quaternion.
+ * @return vglx::Quaternion Unit quaternion, or identity if the input is zero-length.
+ */
+[[nodiscard]] inline constexpr auto Normalize(const Quaternion& q) {
+    auto output = q;
+    output.Normalize();
+    return output;
+}
+
+/**
+ * @brief Spherically interpolates between two rotations along the shortest arc.
+ * @relatesalso Quaternion
+ *
+ * Falls back to normalized linear interpolation when the rotations are
+ * nearly identical, where both methods agree and the linear form is stable.
+ *
+ * @param a Start rotation.
+ * @param b End rotation.
+ * @param f Interpolation factor [0, 1].
+ * @return vglx::Quaternion Interpolated unit quaternion.
+ */
+[[nodiscard]] inline constexpr auto Slerp(const Quaternion& a, const Quaternion& b, float f) {
+    auto end = b;
+    auto cos_theta = Dot(a, b);
+    if (cos_theta < 0.0f) {
+        end = {-b.x, -b.y, -b.z, -b.w};
+        cos_theta = -cos_theta;
+    }
+
+    auto wa = 1.0f - f;
+    auto wb = f;
+    if (cos_theta < 0.9995f) {
+        const auto sin_theta = math::Sqrt(1.0f - cos_theta * cos_theta);
+        const auto theta = math::Atan2(sin_theta, cos_theta);
+        const auto inv_sin = 1.0f / sin_theta;
+        wa = math::Sin(wa * theta) * inv_sin;
+        wb = math::Sin(wb * theta) * inv_sin;
+    }
+
+    return Normalize(Quaternion {
+        a.x * wa + end.x * wb,
+        a.y * wa + end.y * wb,
+        a.z * wa + end.z * wb,
+        a.w * wa + end.w * wb
+    });
+}
+
+}
@@ -0,0 +1,313 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define VGLX_SIMD_SSE 1
+    #include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #define VGLX_SIMD_NEON 1
+    #include <arm_neon.h>
+#endif
+
+#if defined(VGLX_SIMD_SSE) || defined(VGLX_SIMD_NEON)
+    #define VGLX_SIMD 1
+#endif
+
+#if defined(VGLX_SIMD_SSE) && defined(__FMA__)
+    #define VGLX_SIMD_FMA 1
+#endif
+
+/// @cond INTERNAL
+namespace vglx::simd {
+
+#if defined(VGLX_SIMD_SSE)
+
+using Float4 = __m128;
+
+inline auto Load(const float* p) -> Float4 { return _mm_loadu_ps(p); }
+
+inline auto Store(float* p, Float4 v) -> void { _mm_storeu_ps(p, v); }
+
+inline auto Splat(float v) -> Float4 { return _mm_set1_ps(v); }
+
+inline auto Add(Float4 a, Float4 b) -> Float4 { return _mm_add_ps(a, b); }
+
+inline auto Sub(Float4 a, Float4 b) -> Float4 { return _mm_sub_ps(a, b); }
+
+inline auto Mul(Float4 a, Float4 b) -> Float4 { return _mm_mul_ps(a, b); }
+
+inline auto Div(Float4 a, Float4 b) -> Float4 { return _mm_div_ps(a, b); }
+
+inline auto Min(Float4 a, Float4 b) -> Float4 { return _mm_min_ps(a, b); }
+
+inline auto Max(Float4 a, Float4 b) -> Float4 { return _mm_max_ps(a, b); }
+
+inline auto Abs(Float4 v) -> Float4 { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+
+// Returns a * b + c.
+inline auto MulAdd(Float4 a, Float4 b, Float4 c) -> Float4 {
+#if defined(VGLX_SIMD_FMA)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+// Returns a 4-bit mask with one bit per lane where a < b.
+inline auto LessThanMask(Float4 a, Float4 b) -> int {
+    return _mm_movemask_ps(_mm_cmplt_ps(a, b));
+}
+
+// Rounds each lane toward zero. Lanes must fit in a 32-bit integer.
+inline auto Truncate(Float4 v) -> Float4 { return _mm_cvtepi32_ps(_mm_cvttps_epi32(v)); }
+
+// Returns an all-ones lane where a <= b, for use with Select.
+inline auto LessEqual(Float4 a, Float4 b) -> Float4 { return _mm_cmple_ps(a, b); }
+
+// Returns lanes from a where mask is set and from b elsewhere.
+inline auto Select(Float4 mask, Float4 a, Float4 b) -> Float4 {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Negates lanes of v where sign is negative.
+inline auto FlipSign(Float4 v, Float4 sign) -> Float4 {
+    return _mm_xor_ps(v, _mm_and_ps(sign, _mm_set1_ps(-0.0f)));
+}
+
+template <int X, int Y, int Z, int W>
+inline auto Swizzle(Float4 v) -> Float4 {
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+// Takes lanes X, Y from a and lanes Z, W from b.
+template <int X, int Y, int Z, int W>
+inline auto Shuffle(Float4 a, Float4 b) -> Float4 {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+#elif defined(VGLX_SIMD_NEON)
+
+using Float4 = float32x4_t;
+
+inline auto Load(const float* p) -> Float4 { return vld1q_f32(p); }
+
+inline auto Store(float* p, Float4 v) -> void { vst1q_f32(p, v); }
+
+inline auto Splat(float v) -> Float4 { return vdupq_n_f32(v); }
+
+inline auto Add(Float4 a, Float4 b) -> Float4 { return vaddq_f32(a, b); }
+
+inline auto Sub(Float4 a, Float4 b) -> Float4 { return vsubq_f32(a, b); }
+
+inline auto Mul(Float4 a, Float4 b) -> Float4 { return vmulq_f32(a, b); }
+
+inline auto Div(Float4 a, Float4 b) -> Float4 { return vdivq_f32(a, b); }
+
+inline auto Min(Float4 a, Float4 b) -> Float4 { return vminq_f32(a, b); }
+
+inline auto Max(Float4 a, Float4 b) -> Float4 { return vmaxq_f32(a, b); }
+
+inline auto Abs(Float4 v) -> Float4 { return vabsq_f32(v); }
+
+// Returns a * b + c.
+inline auto MulAdd(Float4 a, Float4 b, Float4 c) -> Float4 { return vfmaq_f32(c, a, b); }
+
+// Returns a 4-bit mask with one bit per lane where a < b.
+inline auto LessThanMask(Float4 a, Float4 b) -> int {
+    const uint32x4_t bits = {1, 2, 4, 8};
+    return static_cast<int>(vaddvq_u32(vandq_u32(vcltq_f32(a, b), bits)));
+}
+
+// Rounds each lane toward zero. Lanes must fit in a 32-bit integer.
+inline auto Truncate(Float4 v) -> Float4 { return vcvtq_f32_s32(vcvtq_s32_f32(v)); }
+
+// Returns an all-ones lane where a <= b, for use with Select.
+inline auto LessEqual(Float4 a, Float4 b) -> Float4 { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+
+// Returns lanes from a where mask is set and from b elsewhere.
+inline auto Select(Float4 mask, Float4 a, Float4 b) -> Float4 {
+    return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+}
+
+// Negates lanes of v where sign is negative.
+inline auto FlipSign(Float4 v, Float4 sign) -> Float4 {
+    const auto sign_bits = vandq_u32(vreinterpretq_u32_f32(sign), vdupq_n_u32(0x80000000u));
+    return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v), sign_bits));
+}
+
+#endif
+
+#if defined(VGLX_SIMD)
+
+// Multiplies two column-major 4x4 matrices: out = a * b.
+inline auto MultiplyMatrix4(const float* a, const float* b, float* out) -> void {
+    const auto a0 = Load(a + 0);
+    const auto a1 = Load(a + 4);
+    const auto a2 = Load(a + 8);
+    const auto a3 = Load(a + 12);
+
+    for (auto col = 0; col < 4; ++col) {
+        const auto* b_col = b + col * 4;
+        auto result = Mul(a0, Splat(b_col[0]));
+        result = MulAdd(a1, Splat(b_col[1]), result);
+        result = MulAdd(a2, Splat(b_col[2]), result);
+        result = MulAdd(a3, Splat(b_col[3]), result);
+        Store(out + col * 4, result);
+    }
+}
+
+// The four columns of a column-major 4x4 matrix held in registers.
+struct Columns {
+    Float4 c0;
+    Float4 c1;
+    Float4 c2;
+    Float4 c3;
+};
+
+inline auto LoadColumns(const float* m) -> Columns {
+    return {Load(m + 0), Load(m + 4), Load(m + 8), Load(m + 12)};
+}
+
+// Returns the columns with their signs cleared, used to transform extents.
+inline auto AbsColumns(const Columns& m) -> Columns {
+    return {Abs(m.c0), Abs(m.c1), Abs(m.c2), m.c3};
+}
+
+// Transforms the point (x, y, z, 1). The w lane of the result is unspecified.
+inline auto TransformPoint(const Columns& m, float x, float y, float z) -> Float4 {
+    auto result = MulAdd(m.c0, Splat(x), m.c3);
+    result = MulAdd(m.c1, Splat(y), result);
+    return MulAdd(m.c2, Splat(z), result);
+}
+
+// Transforms a box half-extent by columns from AbsColumns, which yields the
+// half-extent of the axis-aligned box enclosing the transformed box.
+inline auto TransformExtent(const Columns& abs_m, float x, float y, float z) -> Float4 {
+    auto result = Mul(abs_m.c0, Splat(x));
+    result = MulAdd(abs_m.c1, Splat(y), result);
+    return MulAdd(abs_m.c2, Splat(z), result);
+}
+
+// Transforms the box [min, max] and writes the enclosing axis-aligned box to
+// out_min and out_max. Each pointer addresses three floats, and the output
+// may alias the input.
+inline auto TransformBox(
+    const Columns& m,
+    const Columns& abs_m,
+    const float* min,
+    const float* max,
+    float* out_min,
+    float* out_max
+) -> void {
+    const auto center = TransformPoint(
+        m,
+        (min[0] + max[0]) * 0.5f,
+        (min[1] + max[1]) * 0.5f,
+        (min[2] + max[2]) * 0.5f
+    );
+    const auto extent = TransformExtent(
+        abs_m,
+        (max[0] - min[0]) * 0.5f,
+        (max[1] - min[1]) * 0.5f,
+        (max[2] - min[2]) * 0.5f
+    );
+
+    float lo[4];
+    float hi[4];
+    Store(lo, Sub(center, extent));
+    Store(hi, Add(center, extent));
+    for (auto i = 0; i < 3; ++i) {
+        out_min[i] = lo[i];
+        out_max[i] = hi[i];
+    }
+}
+
+#endif
+
+#if defined(VGLX_SIMD_SSE)
+
+// The 2x2 helpers below operate on 2x2 blocks packed as (m00, m01, m10, m11).
+
+inline auto Mat2Mul(Float4 a, Float4 b) -> Float4 {
+    return Add(
+        Mul(a, Swizzle<0, 3, 0, 3>(b)),
+        Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b))
+    );
+}
+
+// Returns adj(a) * b.
+inline auto Mat2AdjMul(Float4 a, Float4 b) -> Float4 {
+    return Sub(
+        Mul(Swizzle<3, 3, 0, 0>(a), b),
+        Mul(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b))
+    );
+}
+
+// Returns a * adj(b).
+inline auto Mat2MulAdj(Float4 a, Float4 b) -> Float4 {
+    return Sub(
+        Mul(a, Swizzle<3, 0, 3, 0>(b)),
+        Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b))
+    );
+}
+
+// Inverts a 4x4 matrix using 2x2 block decomposition. The input is read as
+// four rows, which for column-major storage yields the transposed inverse of
+// the transposed matrix, i.e. the column-major inverse.
+inline auto InverseMatrix4(const float* m, float* out) -> void {
+    const auto r0 = Load(m + 0);
+    const auto r1 = Load(m + 4);
+    const auto r2 = Load(m + 8);
+    const auto r3 = Load(m + 12);
+
+    const auto a = _mm_movelh_ps(r0, r1);
+    const auto b = _mm_movehl_ps(r1, r0);
+    const auto c = _mm_movelh_ps(r2, r3);
+    const auto d = _mm_movehl_ps(r3, r2);
+
+    // Determinants of the four blocks as (|A|, |B|, |C|, |D|).
+    const auto det_sub = Sub(
+        Mul(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+        Mul(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3))
+    );
+    const auto det_a = Swizzle<0, 0, 0, 0>(det_sub);
+    const auto det_b = Swizzle<1, 1, 1, 1>(det_sub);
+    const auto det_c = Swizzle<2, 2, 2, 2>(det_sub);
+    const auto det_d = Swizzle<3, 3, 3, 3>(det_sub);
+
+    const auto d_c = Mat2AdjMul(d, c);
+    const auto a_b = Mat2AdjMul(a, b);
+
+    auto x = Sub(Mul(det_d, a), Mat2Mul(b, d_c));
+    auto w = Sub(Mul(det_a, d), Mat2Mul(c, a_b));
+    auto y = Sub(Mul(det_b, c), Mat2MulAdj(d, a_b));
+    auto z = Sub(Mul(det_c, b), Mat2MulAdj(a, d_c));
+
+    auto trace = Mul(a_b, Swizzle<0, 2, 1, 3>(d_c));
+    trace = Add(trace, Swizzle<2, 3, 0, 1>(trace));
+    trace = Add(trace, Swizzle<1, 0, 3, 2>(trace));
+
+    const auto det = Sub(Add(Mul(det_a, det_d), Mul(det_b, det_c)), trace);
+    const auto inv_det = Div(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+
+    x = Mul(x, inv_det);
+    y = Mul(y, inv_det);
+    z = Mul(z, inv_det);
+    w = Mul(w, inv_det);
+
+    Store(out + 0, Shuffle<3, 1, 3, 1>(x, y));
+    Store(out + 4, Shuffle<2, 0, 2, 0>(x, y));
+    Store(out + 8, Shuffle<3, 1, 3, 1>(z, w));
+    Store(out + 12, Shuffle<2, 0, 2, 0>(z, w));
+}
+
+#endif
+
+}
+/// @endcond
@@ -10,10 +10,13 @@
 #include "vglx_export.h"
 
 #include "vglx/math/matrix4.hpp"
+#include "vglx/math/simd.hpp"
 #include "vglx/math/utilities.hpp"
 #include "vglx/math/vector3.hpp"
 
 #include <algorithm>
+#include <cassert>
+#include <span>
 
 namespace vglx {
 
@@ -105,11 +108,22 @@ struct VGLX_EXPORT Sphere {
      */
     constexpr auto ApplyTransform(const Matrix4& transform) -> void {
         center = transform * center;
+        radius *= MaxScale(transform);
+    }
+
+    /**
+     * @brief Returns the largest axis scale factor of a transform.
+     *
+     * This is the factor @ref ApplyTransform multiplies the radius by.
+     *
+     * @param transform Matrix to inspect.
+     */
+    [[nodiscard]] static constexpr auto MaxScale(const Matrix4& transform) -> float {
         auto& t0 = transform[0];
         auto& t1 = transform[1];
         auto& t2 = transform[2];
 
-        radius *= math::Sqrt(std::max({
+        return math::Sqrt(std::max({
             Vector3 {t0.x, t0.y, t0.z}.LengthSquared(),
             Vector3 {t1.x, t1.y, t1.z}.LengthSquared(),
             Vector3 {t2.x, t2.y, t2.z}.LengthSquared(),
@@ -153,4 +167,93 @@ struct VGLX_EXPORT Sphere {
     }
 };
 
-}
\ No newline at end of file
+/**
+ * @brief Transforms many spheres by one matrix.
+ * @related Sphere
+ *
+ * Batch form of @ref Sphere::ApplyTransform. The radius scale is computed
+ * once for the whole batch. `spheres` and `out` may alias.
+ *
+ * @param spheres Input spheres.
+ * @param transform Matrix to apply.
+ * @param out Output spheres, same length as `spheres`.
+ */
+inline auto ApplyTransform(
+    std::span<const Sphere> spheres,
+    const Matrix4& transform,
+    std::span<Sphere> out
+) -> void {
+    assert(spheres.size() == out.size());
+    const auto scale = Sphere::MaxScale(transform);
+#if defined(VGLX_SIMD)
+    const auto m = simd::LoadColumns(transform.Data());
+    float center[4];
+    for (auto i = 0uz; i < spheres.size(); ++i) {
+        const auto& c = spheres[i].center;
+        simd::Store(center, simd::TransformPoint(m, c.x, c.y, c.z));
+        out[i] = {{center[0], center[1], center[2]}, spheres[i].radius * scale};
+    }
+#else
+    for (auto i = 0uz; i < spheres.size(); ++i) {
+        out[i] = {transform * spheres[i].center, spheres[i].radius * scale};
+    }
+#endif
+}
+
+/**
+ * @brief Transforms spheres pairwise: `out[i]` is `spheres[i]` under `transforms[i]`.
+ * @related Sphere
+ *
+ * @param spheres Input spheres.
+ * @param transforms Matrices to apply, same length as `spheres`.
+ * @param out Output spheres, same length as `spheres`.
+ */
+inline auto ApplyTransform(
+    std::span<const Sphere> spheres,
+    std::span<const Matrix4> transforms,
+    std::span<Sphere> out
+) -> void {
+    assert(spheres.size() == transforms.size() && spheres.size() == out.size());
+#if defined(VGLX_SIMD)
+    float center[4];
+    for (auto i = 0uz; i < spheres.size(); ++i) {
+        const auto& c = spheres[i].center;
+        const auto m = simd::LoadColumns(transforms[i].Data());
+        simd::Store(center, simd::TransformPoint(m, c.x, c.y, c.z));
+        out[i] = {
+            {center[0], center[1], center[2]},
+            spheres[i].radius * Sphere::MaxScale(transforms[i])
+        };
+    }
+#else
+    for (auto i = 0uz; i < spheres.size(); ++i) {
+        out[i] = spheres[i];
+        out[i].ApplyTransform(transforms[i]);
+    }
+#endif
+}
+
+/**
+ * @brief Returns the union of one sphere transformed by each matrix.
+ * @related Sphere
+ *
+ * @param sphere Sphere to transform.
+ * @param transforms Matrices to apply.
+ * @return Enclosing sphere, or an empty sphere if `sphere` is empty or there are no transforms.
+ */
+[[nodiscard]] inline auto TransformedUnion(
+    const Sphere& sphere,
+    std::span<const Matrix4> transforms
+) -> Sphere {
+    auto output = Sphere {};
+    if (sphere.IsEmpty()) return output;
+
+    for (const auto& transform : transforms) {
+        auto transformed = sphere;
+        transformed.ApplyTransform(transform);
+        output.Union(transformed);
+    }
+    return output;
+}
+
+}
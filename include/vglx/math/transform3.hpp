@@ -11,6 +11,7 @@
 
 #include "vglx/math/euler.hpp"
 #include "vglx/math/matrix4.hpp"
+#include "vglx/math/quaternion.hpp"
 #include "vglx/math/utilities.hpp"
 #include "vglx/math/vector3.hpp"
 
@@ -20,9 +21,15 @@ namespace vglx {
  * @brief 3D affine transform with position, rotation, and scale.
  *
  * Transform3 represents a 3D transform combining translation, non-uniform
- * scaling, and Euler-based rotation. It lazily builds a @ref Matrix4
+ * scaling, and quaternion-based rotation. It lazily builds a @ref Matrix4
  * suitable for use as a world transform in scene graphs and rendering code.
  *
+ * The composed matrix is cached together with the rotation basis it was
+ * built from. Position-only updates rewrite just the translation column and
+ * scale-only updates rescale the cached basis, so neither rebuilds the
+ * rotation. Euler angles remain available as a convenience view through
+ * @ref SetRotation(const Euler&) and @ref GetEuler.
+ *
  * @ingroup MathGroup
  */
 class VGLX_EXPORT Transform3 {
@@ -36,8 +43,8 @@ public:
     /// @brief Non-uniform scale in 3D.
     Vector3 scale {1.0f};
 
-     /// @brief Rotation stored as Euler angles.
-    Euler rotation {};
+    /// @brief Rotation stored as a unit quaternion.
+    Quaternion rotation {};
 
     /**
      * @brief Constructs an identity transform.
@@ -47,13 +54,13 @@ public:
     /**
      * @brief Translates the transform in local space.
      *
-     * If the rotation is not empty, the input vector is rotated by the current
-     * orientation before being added to @ref position.
+     * If the rotation is not identity, the input vector is rotated by the
+     * current orientation before being added to @ref position.
      *
      * @param value Translation vector.
      */
     constexpr auto Translate(const Vector3& value) -> void {
-        position += rotation.IsEmpty() ? value : rotation.GetMatrix() * value;
+        position += rotation.IsIdentity() ? value : rotation * value;
         touched = true;
     }
 
@@ -68,22 +75,18 @@ public:
     }
 
     /**
-     * @brief Applies an additional rotation around a principal axis.
+     * @brief Applies an additional rotation around an axis in local space.
      *
-     * Only the canonical axes @ref Vector3::Right, @ref Vector3::Up, and
-     * @ref Vector3::Forward are supported.
+     * The rotation is renormalized when accumulated rounding error drifts it
+     * away from unit length, so this is safe to call every frame.
      *
-     * @param axis Rotation axis.
+     * @param axis Normalized rotation axis.
      * @param angle Rotation angle in radians.
      */
     constexpr auto Rotate(const Vector3& axis, float angle) -> void {
-        assert(axis == Vector3::Right() || axis == Vector3::Up() || axis == Vector3::Forward());
-        if (axis == Vector3::Right()) {
-            rotation.pitch += angle;
-        }else if (axis == Vector3::Up()) {
-            rotation.yaw += angle;
-        } else if (axis == Vector3::Forward()) {
-            rotation.roll += angle;
+        rotation = rotation * Quaternion::FromAxisAngle(axis, angle);
+        if (math::Fabs(rotation.LengthSquared() - 1.0f) > 1e-4f) {
+            rotation.Normalize();
         }
         touched = true;
     }
@@ -122,7 +125,7 @@ public:
         right.Normalize();
         auto up = Cross(forward, right);
 
-        rotation = Euler {{
+        rotation = Quaternion {Matrix4 {
             right.x, up.x, forward.x, 0.0f,
             right.y, up.y, forward.y, 0.0f,
             right.z, up.z, forward.z, 0.0f,
@@ -159,49 +162,59 @@ public:
     /**
      * @brief Sets the rotation component.
      *
-     * @param rotation New Euler rotation.
+     * @param rotation New rotation as a unit quaternion.
      */
-    constexpr auto SetRotation(const Euler& rotation) -> void {
+    constexpr auto SetRotation(const Quaternion& rotation) -> void {
         if (this->rotation != rotation) {
             this->rotation = rotation;
             touched = true;
         }
     }
 
+    /**
+     * @brief Sets the rotation component from Euler angles.
+     *
+     * @param rotation New Euler rotation.
+     */
+    constexpr auto SetRotation(const Euler& rotation) -> void {
+        SetRotation(Quaternion {rotation});
+    }
+
+    /**
+     * @brief Returns the rotation as Euler angles.
+     *
+     * Angles are reconstructed from the quaternion, so they may differ from
+     * the values passed to @ref SetRotation(const Euler&) while describing
+     * the same orientation.
+     */
+    [[nodiscard]] constexpr auto GetEuler() const -> Euler {
+        return rotation.GetEuler();
+    }
+
     /**
      * @brief Returns the 4×4 transform matrix.
      *
      * Recomputes the underlying matrix if any component has changed since the
-     * last call, then returns the cached @ref Matrix4.
+     * last call, then returns the cached @ref Matrix4. Only the parts that
+     * changed are rebuilt.
      */
     [[nodiscard]] constexpr auto Get() -> Matrix4 {
         if (touched) {
-            const auto cos_p = math::Cos(rotation.pitch);
-            const auto sin_p = math::Sin(rotation.pitch);
-            const auto cos_y = math::Cos(rotation.yaw);
-            const auto sin_y = math::Sin(rotation.yaw);
-            const auto cos_r = math::Cos(rotation.roll);
-            const auto sin_r = math::Sin(rotation.roll);
-
-            transform_ = {
-                scale.x * (cos_r * cos_y - sin_r * sin_p * sin_y),
-                scale.y * (-sin_r * cos_p),
-                scale.z * (cos_r * sin_y + sin_r * sin_p * cos_y),
-                position.x,
-
-                scale.x * (sin_r * cos_y + cos_r * sin_p * sin_y),
-                scale.y * (cos_r * cos_p),
-                scale.z * (sin_r * sin_y - cos_r * sin_p * cos_y),
-                position.y,
-
-                scale.x * (-cos_p * sin_y),
-                scale.y * sin_p,
-                scale.z * (cos_p * cos_y),
-                position.z,
-
-                0.0f, 0.0f, 0.0f, 1.0f
-            };
+            auto rescale = scale != cached_scale_;
+            if (rotation != cached_rotation_) {
+                basis_ = rotation.GetMatrix();
+                cached_rotation_ = rotation;
+                rescale = true;
+            }
+
+            if (rescale) {
+                transform_[0] = basis_[0] * scale.x;
+                transform_[1] = basis_[1] * scale.y;
+                transform_[2] = basis_[2] * scale.z;
+                cached_scale_ = scale;
+            }
 
+            transform_[3] = {position.x, position.y, position.z, 1.0f};
             touched = false;
         }
         return transform_;
@@ -210,7 +223,10 @@ public:
 private:
     /// @cond INTERNAL
     Matrix4 transform_ {1.0f};
+    Matrix4 basis_ {1.0f};
+    Quaternion cached_rotation_ {};
+    Vector3 cached_scale_ {1.0f};
     /// @endcond
 };
 
-}
\ No newline at end of file
+}
@@ -9,13 +9,19 @@
 
 #include "vglx_export.h"
 
+#include "vglx/math/simd.hpp"
+
+#include <algorithm>
 #include <bit>
+#include <cassert>
 #include <cinttypes>
 #include <cmath>
 #include <limits>
 #include <random>
+#include <span>
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace vglx::math {
 
@@ -329,6 +335,169 @@ alignas(64) constexpr uint32_t arctan_table[65] {
     return (Atan(y * InverseSqrt(1.0f - y * y)));
 }
 
+/// @cond INTERNAL
+#if defined(VGLX_SIMD)
+
+// Four-lane form of Sin and Cos. The base instruction sets have no gather,
+// so table entries are fetched per lane and the polynomial runs in SIMD.
+inline auto SinCos4(simd::Float4 x, simd::Float4& sin, simd::Float4& cos) -> void {
+    const auto b = simd::Mul(simd::Abs(x), simd::Splat(inv_tau));
+    const auto i = simd::Truncate(b);
+
+    float index[4];
+    float cos_alpha[4];
+    float sin_alpha[4];
+    simd::Store(index, i);
+    for (auto lane = 0; lane < 4; ++lane) {
+        const auto pair = GetTrigPair(static_cast<int32_t>(index[lane]));
+        cos_alpha[lane] = pair.x;
+        sin_alpha[lane] = pair.y;
+    }
+    const auto ca = simd::Load(cos_alpha);
+    const auto sa = simd::Load(sin_alpha);
+
+    const auto beta = simd::Mul(simd::Sub(b, i), simd::Splat(tau_over_256));
+    const auto b2 = simd::Mul(beta, beta);
+    const auto sine_beta = simd::Sub(beta, simd::Mul(simd::Mul(beta, b2), simd::Sub(
+        simd::Splat(0.1666666667f), simd::Mul(b2, simd::Splat(0.0083333333f))
+    )));
+    const auto cosine_beta = simd::Sub(simd::Splat(1.0f), simd::Mul(b2, simd::Sub(
+        simd::Splat(0.5f), simd::Mul(b2, simd::Splat(0.0416666667f))
+    )));
+
+    cos = simd::Sub(simd::Mul(ca, cosine_beta), simd::Mul(sa, sine_beta));
+    sin = simd::FlipSign(simd::Add(simd::Mul(sa, cosine_beta), simd::Mul(ca, sine_beta)), x);
+}
+
+// Four-lane form of Atan.
+inline auto Atan4(simd::Float4 x) -> simd::Float4 {
+    const auto one = simd::Splat(1.0f);
+    const auto abs_x = simd::Abs(x);
+    const auto in_unit = simd::LessEqual(abs_x, one);
+    const auto a = simd::Select(in_unit, abs_x, simd::Div(one, abs_x));
+    const auto i = simd::Truncate(simd::Mul(a, simd::Splat(64.0f)));
+
+    float index[4];
+    float arctan_b[4];
+    simd::Store(index, i);
+    for (auto lane = 0; lane < 4; ++lane) {
+        const auto idx = std::clamp(static_cast<int32_t>(index[lane]), 0, 64);
+        arctan_b[lane] = std::bit_cast<float>(arctan_table[idx]);
+    }
+
+    const auto b = simd::Mul(i, simd::Splat(0.015625f));
+    const auto c = simd::Div(simd::Sub(a, b), simd::Add(simd::Mul(a, b), one));
+    const auto c2 = simd::Mul(c, c);
+    const auto poly = simd::Sub(one, simd::Mul(c2, simd::Add(
+        simd::Splat(0.3333333333f),
+        simd::Mul(c2, simd::Sub(simd::Splat(0.2f), simd::Mul(c2, simd::Splat(0.1428571429f))))
+    )));
+
+    const auto r = simd::Add(simd::Load(arctan_b), simd::Mul(c, poly));
+    return simd::FlipSign(simd::Select(in_unit, r, simd::Sub(simd::Splat(tau_over_4), r)), x);
+}
+
+#endif
+/// @endcond
+
+/**
+ * @brief Computes sine and cosine of every element in a range.
+ * @ingroup MathGroup
+ *
+ * Evaluates four lanes at a time with the same table and polynomial as the
+ * scalar @ref Sin and @ref Cos, so results match them to within rounding.
+ * The input may alias either output.
+ *
+ * @param x Angles in radians.
+ * @param sin_out Receives the sines, same length as `x`.
+ * @param cos_out Receives the cosines, same length as `x`.
+ */
+inline auto SinCos(std::span<const float> x, std::span<float> sin_out, std::span<float> cos_out) -> void {
+    assert(x.size() == sin_out.size() && x.size() == cos_out.size());
+    auto i = 0uz;
+#if defined(VGLX_SIMD)
+    for (; i + 4 <= x.size(); i += 4) {
+        auto sin = simd::Float4 {};
+        auto cos = simd::Float4 {};
+        SinCos4(simd::Load(x.data() + i), sin, cos);
+        simd::Store(sin_out.data() + i, sin);
+        simd::Store(cos_out.data() + i, cos);
+    }
+#endif
+    for (; i < x.size(); ++i) {
+        const auto angle = x[i];
+        sin_out[i] = Sin(angle);
+        cos_out[i] = Cos(angle);
+    }
+}
+
+/**
+ * @brief Computes the sine of every element in a range.
+ * @ingroup MathGroup
+ *
+ * Array form of @ref Sin. The input may alias the output.
+ *
+ * @param x Angles in radians.
+ * @param out Receives the sines, same length as `x`.
+ */
+inline auto Sin(std::span<const float> x, std::span<float> out) -> void {
+    assert(x.size() == out.size());
+    auto i = 0uz;
+#if defined(VGLX_SIMD)
+    for (; i + 4 <= x.size(); i += 4) {
+        auto sin = simd::Float4 {};
+        auto cos = simd::Float4 {};
+        SinCos4(simd::Load(x.data() + i), sin, cos);
+        simd::Store(out.data() + i, sin);
+    }
+#endif
+    for (; i < x.size(); ++i) out[i] = Sin(x[i]);
+}
+
+/**
+ * @brief Computes the cosine of every element in a range.
+ * @ingroup MathGroup
+ *
+ * Array form of @ref Cos. The input may alias the output.
+ *
+ * @param x Angles in radians.
+ * @param out Receives the cosines, same length as `x`.
+ */
+inline auto Cos(std::span<const float> x, std::span<float> out) -> void {
+    assert(x.size() == out.size());
+    auto i = 0uz;
+#if defined(VGLX_SIMD)
+    for (; i + 4 <= x.size(); i += 4) {
+        auto sin = simd::Float4 {};
+        auto cos = simd::Float4 {};
+        SinCos4(simd::Load(x.data() + i), sin, cos);
+        simd::Store(out.data() + i, cos);
+    }
+#endif
+    for (; i < x.size(); ++i) out[i] = Cos(x[i]);
+}
+
+/**
+ * @brief Computes the arctangent of every element in a range.
+ * @ingroup MathGroup
+ *
+ * Array form of @ref Atan with the same accuracy. The input may alias the
+ * output.
+ *
+ * @param x Input values.
+ * @param out Receives atan(x) in radians, same length as `x`.
+ */
+inline auto Atan(std::span<const float> x, std::span<float> out) -> void {
+    assert(x.size() == out.size());
+    auto i = 0uz;
+#if defined(VGLX_SIMD)
+    for (; i + 4 <= x.size(); i += 4) {
+        simd::Store(out.data() + i, Atan4(simd::Load(x.data() + i)));
+    }
+#endif
+    for (; i < x.size(); ++i) out[i] = Atan(x[i]);
+}
+
 /**
  * @brief Generates a UUID string (version 4-like).
  * @ingroup MathGroup
@@ -336,7 +505,7 @@ alignas(64) constexpr uint32_t arctan_table[65] {
  * @return Random UUID as a string.
  */
 [[nodiscard]] VGLX_EXPORT inline auto GenerateUUID() {
-    static std::vector<std::string> lut{
+    static const std::vector<std::string> lut{
         "00", "01", "02", "03", "04", "05", "06", "07", "08", "09", "0a",
         "0b", "0c", "0d", "0e", "0f", "10", "11", "12", "13", "14", "15",
         "16", "17", "18", "19", "1a", "1b", "1c", "1d", "1e", "1f", "20",
@@ -363,9 +532,9 @@ alignas(64) constexpr uint32_t arctan_table[65] {
         "fd", "fe", "ff"
     };
 
-    static std::random_device rd;
-    static std::mt19937 e2(rd());
-    static std::uniform_real_distribution dist(0.0, 1.0);
+    thread_local std::random_device rd;
+    thread_local std::mt19937 e2(rd());
+    thread_local std::uniform_real_distribution dist(0.0, 1.0);
 
     const auto d0 = static_cast<size_t>(dist(e2) * 0xffffffff) | 0;
     const auto d1 = static_cast<size_t>(dist(e2) * 0xffffffff) | 0;
@@ -74,6 +74,16 @@ public:
     /// @brief If true, the node is subject to frustum culling during rendering.
     bool frustum_culled {true};
 
+    /**
+     * @brief If true, removing a child preserves the order of the remaining children.
+     *
+     * By default child removal is constant time: the last child is moved into
+     * the removed slot, so the order of the remaining children changes.
+     * Enable this for nodes whose children order matters, at the cost of
+     * removal being linear in the number of children.
+     */
+    bool preserve_child_order {false};
+
     /**
      * @brief Constructs an Node instance.
      */
@@ -287,8 +297,10 @@ private:
     class Impl;
     std::unique_ptr<Impl> impl_;
 
+    friend class RenderLists;
     friend class Scene;
     auto AttachRecursive(SharedContextPointer context) -> void;
+    [[nodiscard]] auto CachedWorldTransform() const -> const Matrix4&;
     /// @endcond
 };
 
@@ -12,6 +12,8 @@
  * @brief Utility classes for rendering and debugging
  */
 
+#include "vglx/utilities/allocation_tracker.hpp"
 #include "vglx/utilities/frame_timer.hpp"
+#include "vglx/utilities/profiler.hpp"
 #include "vglx/utilities/stats.hpp"
 #include "vglx/utilities/timer.hpp"
\ No newline at end of file
@@ -0,0 +1,57 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <cstddef>
+
+namespace vglx {
+
+/**
+ * @brief Counts heap allocations made through the global `operator new`.
+ *
+ * When the engine is built with `VGLX_TRACK_ALLOCATIONS`, the library
+ * replaces the global allocation functions with thin wrappers that count
+ * every allocation on the calling thread before forwarding to `malloc`.
+ * Counters are thread-local, so the numbers reported for the render thread
+ * are not disturbed by loader or worker threads. @ref Stats records the
+ * allocation count for every frame, which makes it easy to verify that a
+ * scene renders without touching the allocator once it reaches a steady
+ * state.
+ *
+ * Without `VGLX_TRACK_ALLOCATIONS`, the global allocation functions are left
+ * untouched and every counter reads zero.
+ *
+ * @code
+ * const auto before = vglx::AllocationTracker::ThreadAllocations();
+ * renderer.Render(scene, camera);
+ * const auto allocations = vglx::AllocationTracker::ThreadAllocations() - before;
+ * @endcode
+ *
+ * @ingroup UtilitiesGroup
+ */
+class VGLX_EXPORT AllocationTracker {
+public:
+    /**
+     * @brief Returns true if the engine was built with allocation tracking.
+     */
+    [[nodiscard]] static auto IsEnabled() -> bool;
+
+    /**
+     * @brief Number of allocations made by the calling thread since it started.
+     */
+    [[nodiscard]] static auto ThreadAllocations() -> std::size_t;
+
+    /**
+     * @brief Number of bytes requested by the calling thread since it started.
+     */
+    [[nodiscard]] static auto ThreadAllocatedBytes() -> std::size_t;
+};
+
+}
@@ -0,0 +1,160 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx_export.h"
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <string>
+
+namespace vglx {
+
+namespace fs = std::filesystem;
+
+/**
+ * @brief Low-overhead CPU profiler with Chrome trace export.
+ *
+ * Profiler records named zones into per-thread buffers while a capture is
+ * active. Each thread only ever writes to its own buffer, so recording a zone
+ * takes no locks: it reads the clock twice and appends one event. Captured
+ * zones can be written as a Chrome trace file and opened in
+ * `chrome://tracing` or [Perfetto](https://ui.perfetto.dev).
+ *
+ * Zones are usually declared through the @ref VGLX_PROFILE_SCOPE and
+ * @ref VGLX_PROFILE_FUNCTION macros, which compile to nothing unless the
+ * engine is built with `VGLX_ENABLE_PROFILER`.
+ *
+ * @code
+ * auto MyApp::Update(float delta) -> bool {
+ *     VGLX_PROFILE_FUNCTION();
+ *     ...
+ * }
+ *
+ * vglx::Profiler::BeginCapture();
+ * // run a few frames
+ * vglx::Profiler::EndCapture();
+ * vglx::Profiler::WriteChromeTrace("trace.json");
+ * @endcode
+ *
+ * @ingroup UtilitiesGroup
+ */
+class VGLX_EXPORT Profiler {
+public:
+    /**
+     * @brief Maximum number of zones recorded per thread in a single capture.
+     *
+     * Zones beyond this limit are dropped and counted by @ref DroppedZones.
+     */
+    static constexpr std::size_t kMaxZonesPerThread = 1 << 16;
+
+    /**
+     * @brief RAII zone that records its lifetime while a capture is active.
+     *
+     * The name must outlive the capture, typically a string literal.
+     */
+    class VGLX_EXPORT Zone {
+    public:
+        /**
+         * @brief Opens a zone.
+         *
+         * @param name Zone name. Must remain valid until the trace is written.
+         */
+        explicit Zone(const char* name);
+
+        Zone(const Zone&) = delete;
+        auto operator=(const Zone&) -> Zone& = delete;
+
+        /**
+         * @brief Closes the zone and records it.
+         */
+        ~Zone();
+
+    private:
+        /// @brief Zone name.
+        const char* name_;
+
+        /// @brief Start timestamp in nanoseconds, zero if not capturing.
+        uint64_t start_ {0};
+    };
+
+    /**
+     * @brief Starts a new capture, discarding zones from the previous one.
+     */
+    static auto BeginCapture() -> void;
+
+    /**
+     * @brief Stops recording zones. Recorded zones are kept until the next
+     * capture begins.
+     */
+    static auto EndCapture() -> void;
+
+    /**
+     * @brief Checks whether a capture is active.
+     */
+    [[nodiscard]] static auto IsCapturing() -> bool;
+
+    /**
+     * @brief Returns the number of zones recorded in the current capture.
+     */
+    [[nodiscard]] static auto RecordedZones() -> std::size_t;
+
+    /**
+     * @brief Returns the number of zones dropped because a thread buffer was full.
+     */
+    [[nodiscard]] static auto DroppedZones() -> std::size_t;
+
+    /**
+     * @brief Returns the number of full-size thread buffers currently allocated.
+     *
+     * A thread's buffer is released when the thread exits, after its zones
+     * are flushed, and is reused by threads started later.
+     */
+    [[nodiscard]] static auto AllocatedBuffers() -> std::size_t;
+
+    /**
+     * @brief Serializes the current capture in the Chrome trace event format.
+     *
+     * Zones are emitted as complete (`"ph": "X"`) events with microsecond
+     * timestamps relative to the start of the capture.
+     */
+    [[nodiscard]] static auto ToChromeTrace() -> std::string;
+
+    /**
+     * @brief Writes the current capture to a Chrome trace JSON file.
+     *
+     * @param path Output file path.
+     * @return std::expected<void, std::string> Error message on failure.
+     */
+    static auto WriteChromeTrace(const fs::path& path) -> std::expected<void, std::string>;
+};
+
+}
+
+/// @cond INTERNAL
+#define VGLX_PROFILE_CONCAT_IMPL(a, b) a##b
+#define VGLX_PROFILE_CONCAT(a, b) VGLX_PROFILE_CONCAT_IMPL(a, b)
+/// @endcond
+
+#ifdef VGLX_ENABLE_PROFILER
+/**
+ * @brief Profiles the enclosing scope under the given name.
+ * @ingroup UtilitiesGroup
+ */
+#define VGLX_PROFILE_SCOPE(name) \
+    const ::vglx::Profiler::Zone VGLX_PROFILE_CONCAT(vglx_profile_zone_, __LINE__) {name}
+#else
+#define VGLX_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
+
+/**
+ * @brief Profiles the enclosing function under its name.
+ * @ingroup UtilitiesGroup
+ */
+#define VGLX_PROFILE_FUNCTION() VGLX_PROFILE_SCOPE(__func__)
@@ -9,17 +9,29 @@
 
 #include "vglx_export.h"
 
+#include "vglx/core/renderer.hpp"
+
+#include <cstddef>
+#include <expected>
+#include <filesystem>
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace vglx {
 
+namespace fs = std::filesystem;
+
 /**
- * @brief Collects and visualizes runtime performance statistics.
+ * @brief Collects, reports and visualizes runtime performance statistics.
  *
- * This class tracks frames per second, frame time, and the number of rendered
- * objects per frame. It is used by the runtime when @ref Application
- * "show_stats" is set to true to provide an on-screen performance overlay
- * during development and debugging.
+ * This class tracks frames per second, CPU and GPU frame time, the number
+ * of rendered objects and the number of heap allocations per frame. Every frame is recorded as a
+ * @ref FrameSample, which makes it possible to compute frame time percentiles,
+ * detect hitches and export the capture as CSV or JSON without a UI. It is
+ * used by the runtime when @ref Application "show_stats" is set to true to
+ * provide an on-screen performance overlay during development and debugging.
  *
  * @code
  * while (running) {
@@ -28,21 +40,69 @@ namespace vglx {
  *   stats.AfterRender(renderer.RenderedObjectsPerFrame());
  *   stats.Draw();
  * }
+ *
+ * const auto summary = stats.GetSummary();
+ * stats.Write("frames.csv");
  * @endcode
  *
- * This overlay currently requires [ImGui](https://github.com/ocornut/imgui) support.
+ * The overlay requires [ImGui](https://github.com/ocornut/imgui) support.
  * If the engine is not compiled with `VGLX_USE_IMGUI`, the @ref Draw method
- * becomes a no-op.
+ * becomes a no-op, while capture and export keep working.
  *
  * @ingroup UtilitiesGroup
  */
-class Stats {
+class VGLX_EXPORT Stats {
 public:
+    /// @brief Parameters for constructing a @ref Stats object.
+    struct Parameters {
+        /// Number of most recent frames kept for percentiles and export.
+        std::size_t capacity {36000};
+        /// Frames slower than this many milliseconds are hitches.
+        double hitch_threshold {50.0};
+        /// Frames slower than this multiple of the running average are hitches. Zero disables.
+        double hitch_ratio {2.5};
+    };
+
+    /// @brief Measurements recorded for a single frame.
+    struct FrameSample {
+        std::size_t frame {0}; ///< Frame index since construction or @ref Reset.
+        double frame_time {0.0}; ///< Milliseconds since the previous frame started.
+        double render_time {0.0}; ///< CPU milliseconds between @ref BeforeRender and @ref AfterRender.
+        double gpu_time {0.0}; ///< Most recent GPU frame time in milliseconds, see @ref RecordGPUTimings.
+        unsigned objects {0}; ///< Objects rendered in the frame.
+        std::size_t allocations {0}; ///< Heap allocations on the rendering thread, see @ref AllocationTracker.
+        bool hitch {false}; ///< Whether the frame exceeded a hitch threshold.
+    };
+
+    /// @brief Frame time distribution over the recorded frames, in milliseconds.
+    struct Summary {
+        std::size_t frames {0}; ///< Number of frames summarized.
+        std::size_t hitches {0}; ///< Number of frames flagged as hitches.
+        double average {0.0}; ///< Average frame time.
+        double p50 {0.0}; ///< Median frame time.
+        double p95 {0.0}; ///< 95th percentile frame time.
+        double p99 {0.0}; ///< 99th percentile frame time.
+        double max {0.0}; ///< Slowest frame.
+        double gpu_p50 {0.0}; ///< Median GPU frame time.
+        double gpu_p95 {0.0}; ///< 95th percentile GPU frame time.
+        std::size_t max_allocations {0}; ///< Most heap allocations in a single frame.
+    };
+
+    /// @brief Callback invoked with a periodic @ref Summary.
+    using ReportCallback = std::function<void(const Summary&)>;
+
     /**
-     * @brief Constructs a stats object.
+     * @brief Constructs a stats object with default parameters.
      */
     Stats();
 
+    /**
+     * @brief Constructs a stats object.
+     *
+     * @param params @ref Stats::Parameters "Capture parameters".
+     */
+    explicit Stats(const Parameters& params);
+
     /**
      * @brief Marks the beginning of a frame render.
      *
@@ -54,19 +114,77 @@ public:
     /**
      * @brief Marks the end of a frame render.
      *
-     * Updates frame time and records the number of rendered objects. The number
-     * of objects can be retrieved from the
+     * Updates frame time and records the frame sample. The number of objects
+     * can be retrieved from the
      * @ref Renderer::RenderedObjectsPerFrame "renderer".
      *
      * @param n_objects Number of objects rendered in the frame.
      */
     auto AfterRender(unsigned n_objects) -> void;
 
+    /**
+     * @brief Records the GPU timings reported by the renderer.
+     *
+     * The overlay shows the per-phase breakdown and whether the frame is CPU
+     * or GPU bound. Timings can be retrieved from the
+     * @ref Renderer::GetGPUTimings "renderer".
+     *
+     * @param timings GPU time per render phase.
+     */
+    auto RecordGPUTimings(const Renderer::GPUTimings& timings) -> void;
+
+    /**
+     * @brief Computes the frame time distribution over the recorded frames.
+     */
+    [[nodiscard]] auto GetSummary() const -> Summary;
+
+    /**
+     * @brief Returns the recorded frames from oldest to newest.
+     */
+    [[nodiscard]] auto GetSamples() const -> std::vector<FrameSample>;
+
+    /**
+     * @brief Serializes the recorded frames as CSV, one row per frame.
+     */
+    [[nodiscard]] auto ToCSV() const -> std::string;
+
+    /**
+     * @brief Serializes the summary and the recorded frames as JSON.
+     */
+    [[nodiscard]] auto ToJSON() const -> std::string;
+
+    /**
+     * @brief Writes the recorded frames to a file.
+     *
+     * The format is chosen from the extension, `.csv` or `.json`.
+     *
+     * @param path Output file path.
+     * @return std::expected<void, std::string> Error message on failure.
+     */
+    auto Write(const fs::path& path) const -> std::expected<void, std::string>;
+
+    /**
+     * @brief Invokes a callback with the current summary at a fixed interval.
+     *
+     * Intended for unattended runs that forward frame time percentiles to
+     * logs or telemetry. The callback runs on the thread that calls
+     * @ref BeforeRender.
+     *
+     * @param callback Callback receiving the summary. Pass an empty function to disable.
+     * @param interval Interval between reports in seconds.
+     */
+    auto OnReport(ReportCallback callback, double interval) -> void;
+
+    /**
+     * @brief Discards all recorded frames.
+     */
+    auto Reset() -> void;
+
     /**
      * @brief Draws the performance overlay.
      *
-     * Renders a window containing FPS, frame time, and rendered object
-     * histograms.
+     * Renders a window containing FPS, frame time, GPU time, and rendered
+     * object histograms.
      */
     auto Draw() const -> void;
 
@@ -74,9 +192,9 @@ public:
 
 private:
     /// @cond INTERNAL
-    class Impl;
+    struct Impl;
     std::unique_ptr<Impl> impl_;
     /// @endcond
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+Runs a Google Benchmark executable and compares it against a stored baseline.
+
+Each benchmark is run with repetitions and its median CPU time is compared
+with the baseline. A benchmark regresses when it is slower than the baseline
+by more than the tolerance, e.g. 0.15 allows a 15% slowdown. The script exits
+with 1 on any regression and with 77 when no baseline exists yet, which CTest
+reports as skipped. With --require-baseline a missing baseline fails instead,
+so a gate on CI cannot pass silently.
+
+Baselines are machine specific. Record them on the machine that runs the gate:
+
+    scripts/bench_compare.py build/benchmarks/run_node_bench \\
+        --baseline benchmarks/baselines/node_bench.json --update
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import subprocess
+import sys
+
+from pathlib import Path
+
+EXIT_REGRESSION = 1
+EXIT_NO_BASELINE = 77
+
+TIME_UNITS_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+def make_info(message: str):
+    print(f"→ [INFO] {message}")
+
+def make_warning(message: str):
+    print(f"→ [WARNING] {message}")
+
+def make_error(title: str, message: str | None = None):
+    print(f"→ [ERROR] {title}", file=sys.stderr)
+    if message: print(f"  {message}", file=sys.stderr)
+    sys.exit(2)
+
+def run_benchmark(executable: Path, output: Path, repetitions: int, bench_filter: str | None):
+    output.parent.mkdir(parents=True, exist_ok=True)
+    args = [
+        str(executable),
+        f"--benchmark_out={output}",
+        "--benchmark_out_format=json",
+        f"--benchmark_repetitions={repetitions}",
+        "--benchmark_report_aggregates_only=true",
+    ]
+    if bench_filter:
+        args.append(f"--benchmark_filter={bench_filter}")
+
+    try:
+        result = subprocess.run(args, cwd=executable.parent)
+    except FileNotFoundError as exc:
+        make_error("Failed to run benchmark.", str(exc))
+    if result.returncode != 0:
+        make_error("Benchmark exited with an error.", f"exit code {result.returncode}")
+
+    with output.open() as file:
+        return json.load(file)
+
+def median_times(results: dict) -> dict[str, float]:
+    """Returns the median CPU time in nanoseconds for every benchmark."""
+    times = {}
+    for entry in results.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            make_warning(f"{entry['name']} reported an error: {entry.get('error_message', '')}")
+            continue
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") != "median": continue
+            name = entry["run_name"]
+        else:
+            name = entry["name"]
+        times[name] = entry["cpu_time"] * TIME_UNITS_NS[entry.get("time_unit", "ns")]
+    return times
+
+def write_baseline(path: Path, results: dict, times: dict[str, float]):
+    context = results.get("context", {})
+    baseline = {
+        "context": {
+            "host_name": context.get("host_name"),
+            "num_cpus": context.get("num_cpus"),
+            "mhz_per_cpu": context.get("mhz_per_cpu"),
+        },
+        "benchmarks": {name: {"cpu_time_ns": round(time, 3)} for name, time in sorted(times.items())},
+    }
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with path.open("w") as file:
+        json.dump(baseline, file, indent=2)
+        file.write("\n")
+    make_info(f"Wrote baseline with {len(times)} benchmarks to {path}")
+
+def compare(baseline: dict[str, float], current: dict[str, float], tolerance: float):
+    regressions = []
+    width = max((len(name) for name in baseline | current), default=0)
+    print(f"\n{'Benchmark':<{width}}  {'Baseline':>12}  {'Current':>12}  {'Change':>8}")
+    for name in sorted(baseline):
+        if name not in current:
+            make_warning(f"{name} is in the baseline but was not run")
+            continue
+        base, cur = baseline[name], current[name]
+        change = cur / base - 1.0 if base > 0 else 0.0
+        status = ""
+        if change > tolerance:
+            status = "REGRESSION"
+            regressions.append(name)
+        elif change < -tolerance:
+            status = "improved"
+        print(f"{name:<{width}}  {base:>10.1f}ns  {cur:>10.1f}ns  {change:>+7.1%}  {status}")
+
+    for name in sorted(current.keys() - baseline.keys()):
+        make_info(f"{name} has no baseline entry")
+
+    return regressions
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare benchmark results against a stored baseline.")
+    parser.add_argument("benchmark", type=Path, help="Google Benchmark executable")
+    parser.add_argument("--baseline", type=Path, required=True, help="Baseline JSON file")
+    parser.add_argument("--output", type=Path, help="Where to write the raw JSON results")
+    parser.add_argument("--tolerance", type=float, default=0.15, help="Allowed slowdown as a fraction (default: 0.15)")
+    parser.add_argument("--repetitions", type=int, default=5, help="Repetitions per benchmark (default: 5)")
+    parser.add_argument("--filter", help="Only run benchmarks matching this regex")
+    parser.add_argument("--update", action="store_true", help="Record the results as the new baseline")
+    parser.add_argument("--require-baseline", action="store_true", help="Fail instead of skipping when the baseline is missing")
+    args = parser.parse_args()
+
+    executable = args.benchmark.resolve()
+    output = args.output or executable.parent / "results" / f"{executable.name}.json"
+
+    if not args.update and not args.baseline.exists():
+        if args.require_baseline:
+            print(f"→ [ERROR] No baseline at {args.baseline}, run with --update to record one", file=sys.stderr)
+            sys.exit(EXIT_REGRESSION)
+        make_warning(f"No baseline at {args.baseline}, run with --update to record one")
+        sys.exit(EXIT_NO_BASELINE)
+
+    results = run_benchmark(executable, output.resolve(), args.repetitions, args.filter)
+    current = median_times(results)
+
+    if args.update:
+        write_baseline(args.baseline, results, current)
+        return
+
+    with args.baseline.open() as file:
+        stored = json.load(file)
+    baseline = {name: entry["cpu_time_ns"] for name, entry in stored.get("benchmarks", {}).items()}
+
+    regressions = compare(baseline, current, args.tolerance)
+    if regressions:
+        print(f"\n→ [ERROR] {len(regressions)} benchmark(s) regressed by more than {args.tolerance:.0%}:", file=sys.stderr)
+        for name in regressions: print(f"  {name}", file=sys.stderr)
+        sys.exit(EXIT_REGRESSION)
+
+    make_info(f"No regressions beyond {args.tolerance:.0%}")
+
+if __name__ == "__main__":
+    main()
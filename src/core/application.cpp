@@ -12,6 +12,7 @@
 #include "vglx/core/shared_context.hpp"
 #include "vglx/core/window.hpp"
 #include "vglx/utilities/frame_timer.hpp"
+#include "vglx/utilities/profiler.hpp"
 #include "vglx/utilities/stats.hpp"
 
 #include "utilities/logger.hpp"
@@ -44,6 +45,8 @@ struct Application::Impl {
     std::unique_ptr<Renderer> renderer;
     std::unique_ptr<SharedContext> context;
 
+    Stats stats;
+
     double last_frame_time = 0.0;
 
     auto InitializeWindow(const Application::Parameters& params) -> std::expected<void, std::string> {
@@ -61,7 +64,11 @@ struct Application::Impl {
         renderer = std::make_unique<Renderer>(Renderer::Parameters {
             .framebuffer_width = window->FramebufferWidth(),
             .framebuffer_height = window->FramebufferHeight(),
-            .clear_color = params.clear_color
+            .clear_color = params.clear_color,
+            .incremental_render_lists = params.incremental_render_lists,
+            .program_cache_directory = params.program_cache_directory,
+            .parallel_shader_compile = params.parallel_shader_compile,
+            .dynamic_light_count = params.dynamic_light_count
         });
         return renderer->Initialize();
     }
@@ -99,6 +106,7 @@ Application::Application() : impl_(std::make_unique<Impl>()) {}
 auto Application::Setup() -> void {
     const auto params = Configure();
     show_stats_ = params.show_stats;
+    stats_output_ = params.stats_output;
 
     auto init_window_result = impl_->InitializeWindow(params);
     if (!init_window_result) {
@@ -135,17 +143,28 @@ auto Application::Start() -> void {
     Setup();
 
     auto frame_timer = FrameTimer {true};
-    auto stats = Stats {};
+    auto& stats = impl_->stats;
 
     while (!impl_->window->ShouldClose()) {
-        impl_->window->PollEvents();
+        VGLX_PROFILE_SCOPE("Frame");
+
+        {
+            VGLX_PROFILE_SCOPE("Application::PollEvents");
+            impl_->window->PollEvents();
+        }
 
         const auto dt = frame_timer.Tick();
-        impl_->scene->Advance(dt);
+        {
+            VGLX_PROFILE_SCOPE("Scene::Advance");
+            impl_->scene->Advance(dt);
+        }
 
         impl_->window->BeginUIFrame();
-        if (!Update(dt)) {
-            impl_->window->RequestClose();
+        {
+            VGLX_PROFILE_SCOPE("Application::Update");
+            if (!Update(dt)) {
+                impl_->window->RequestClose();
+            }
         }
         if (show_stats_) {
             stats.Draw();
@@ -153,10 +172,23 @@ auto Application::Start() -> void {
 
         stats.BeforeRender();
         impl_->renderer->Render(impl_->scene.get(), impl_->camera.get());
+        impl_->renderer->BeginUIPass();
         impl_->window->EndUIFrame();
+        impl_->renderer->EndUIPass();
 
         stats.AfterRender(impl_->renderer->RenderedObjectsPerFrame());
-        impl_->window->SwapBuffers();
+        stats.RecordGPUTimings(impl_->renderer->GetGPUTimings());
+        {
+            VGLX_PROFILE_SCOPE("Window::SwapBuffers");
+            impl_->window->SwapBuffers();
+        }
+    }
+
+    if (!stats_output_.empty()) {
+        const auto result = stats.Write(stats_output_);
+        if (!result) {
+            Logger::Log(LogLevel::Error, "{}", result.error());
+        }
     }
 }
 
@@ -164,6 +196,10 @@ auto Application::GetContext() const -> SharedContextPointer {
     return impl_->context.get();
 }
 
+auto Application::GetStats() const -> Stats* {
+    return &impl_->stats;
+}
+
 auto Application::GetScene() const -> Scene* {
     return impl_->scene.get();
 }
@@ -0,0 +1,21 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/core/identity.hpp"
+
+#include <atomic>
+
+namespace vglx {
+
+auto Identity::NextId() -> uint64_t {
+    // Identifiers only need to be unique within a process, so a relaxed
+    // counter is enough and stays safe when objects are created on loader threads.
+    static std::atomic<uint64_t> counter {1};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+}
@@ -62,7 +62,10 @@ ProgramAttributes::ProgramAttributes(
     flat_shaded = material->flat_shaded;
     fog = material->fog && scene->fog != nullptr;
     instancing = renderable->GetNodeType() == Node::Type::InstancedMesh;
-    num_lights = lights.directional + lights.point + lights.spot;
+    dynamic_lights = lights.dynamic;
+    num_lights = dynamic_lights
+        ? lights.capacity
+        : lights.directional + lights.point + lights.spot;
     two_sided = material->two_sided;
     vertex_color = geometry->HasAttribute(VertexAttributeType::Color);
     tangent = geometry->HasAttribute(VertexAttributeType::Tangent);
@@ -73,9 +76,11 @@ ProgramAttributes::ProgramAttributes(
     key |= (color ? 1 : 0)  << 4; // 1 bit
     key |= (flat_shaded ? 1 : 0) << 9; // 1 bit
     key |= (fog ? 1 : 0) << 10; // 1 bit
-    key |= (lights.directional & 0xF) << 5; // (0–15) → 4 bits
-    key |= (lights.point & 0xF) << 11; // (0–15) → 4 bits
-    key |= (lights.spot & 0xF) << 15; // (0–15) → 4 bits
+    if (!dynamic_lights) {
+        key |= (lights.directional & 0xF) << 5; // (0–15) → 4 bits
+        key |= (lights.point & 0xF) << 11; // (0–15) → 4 bits
+        key |= (lights.spot & 0xF) << 15; // (0–15) → 4 bits
+    }
     key |= (albedo_map ? 1 : 0) << 19; // 1 bit
     key |= (alpha_map ? 1 : 0) << 20; // 1 bit
     key |= (normal_map ? 1 : 0) << 21; // 1 bit
@@ -85,6 +90,7 @@ ProgramAttributes::ProgramAttributes(
     key |= (tangent ? 1 : 0) << 25; // 1 bit
     key |= (specular_map ? 1 : 0) << 26; // 1 bit
     key |= (texture_map ? 1 : 0) << 27; // 1 bit
+    key |= (dynamic_lights ? 1 : 0) << 28; // 1 bit
 }
 
 }
\ No newline at end of file
@@ -21,6 +21,12 @@ struct ProgramAttributes {
         uint8_t directional {0};
         uint8_t point {0};
         uint8_t spot {0};
+
+        // When set, the counts stay out of the program key and the shader
+        // loops over the light count stored in the lights uniform block
+        // instead, with the array sized to `capacity`.
+        bool dynamic {false};
+        uint8_t capacity {0};
     };
 
     std::size_t key {0};
@@ -34,6 +40,7 @@ struct ProgramAttributes {
     uint8_t num_lights {0};
 
     bool color {false};
+    bool dynamic_lights {false};
     bool flat_shaded {false};
     bool fog {false};
     bool instancing {false};
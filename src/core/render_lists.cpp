@@ -7,52 +7,132 @@
 
 #include "core/render_lists.hpp"
 
-#include <ranges>
+#include "vglx/events/scene_event.hpp"
+#include "vglx/utilities/profiler.hpp"
+
+#include <algorithm>
+#include <functional>
 #include <limits>
 
 namespace vglx {
 
-// Compare function for sorting meshes based on their z position.
+namespace {
+
+// Bottom-up merge sort into `scratch`, which lives on the frame arena. Unlike
+// std::stable_sort it never requests a temporary buffer from the allocator.
+template <typename Compare>
+auto stable_sort(std::pmr::vector<RenderItem>& items, std::pmr::vector<RenderItem>& scratch, Compare compare) -> void {
+    const auto n = items.size();
+    if (n < 2) return;
+    scratch.resize(n);
+
+    auto src = items.data();
+    auto dst = scratch.data();
+    for (auto width = 1uz; width < n; width *= 2) {
+        for (auto lo = 0uz; lo < n; lo += width * 2) {
+            const auto mid = std::min(lo + width, n);
+            const auto hi = std::min(lo + width * 2, n);
+            std::ranges::merge(
+                src + lo, src + mid,
+                src + mid, src + hi,
+                dst + lo,
+                compare, &RenderItem::depth, &RenderItem::depth
+            );
+        }
+        std::swap(src, dst);
+    }
+
+    // Buffers are not swapped so that each list keeps its own capacity.
+    if (src != items.data()) std::ranges::copy(src, src + n, items.data());
+}
+
+// Stable insertion sort that runs in near-linear time when the input is
+// almost sorted, which is the common case between consecutive frames.
+// Falls back to a regular stable sort once the ordering changed too much.
+template <typename Compare>
+auto adaptive_sort(std::pmr::vector<RenderItem>& items, std::pmr::vector<RenderItem>& scratch, Compare compare) -> void {
+    auto budget = items.size() * 8;
+    for (auto i = 1uz; i < items.size(); ++i) {
+        if (!compare(items[i].depth, items[i - 1].depth)) continue;
+
+        auto item = items[i];
+        auto j = i;
+        do {
+            items[j] = items[j - 1];
+            --j;
+        } while (j > 0 && compare(item.depth, items[j - 1].depth));
+        items[j] = item;
+
+        if (i - j > budget) {
+            stable_sort(items, scratch, compare);
+            return;
+        }
+        budget -= i - j;
+    }
+}
+
+auto in_scene(const Node* node, const Scene* scene) -> bool {
+    while (node->Parent() != nullptr) {
+        node = node->Parent();
+    }
+    return node == scene;
+}
+
+}
+
+RenderLists::RenderLists(bool incremental) : incremental_(incremental) {
+    frame_.emplace(arena_.Resource());
 
+    if (!incremental_) return;
+
+    event_listener_ = std::make_shared<EventListener>([this](Event* event) {
+        OnSceneEvent(event);
+    });
+    EventDispatcher::Get().AddEventListener("node_added", event_listener_);
+    EventDispatcher::Get().AddEventListener("node_removed", event_listener_);
+}
 
 auto RenderLists::ProcessScene(Scene* scene, Camera* camera) -> void {
+    VGLX_PROFILE_SCOPE("RenderLists::ProcessScene");
+
     Reset();
 
+    // The renderer updates the scene hierarchy before processing the scene,
+    // so cached world transforms are current for the rest of the frame.
+    const auto& camera_world = camera->CachedWorldTransform();
+    camera_position_ = Vector3 {camera_world[3].x, camera_world[3].y, camera_world[3].z};
+    camera_forward_ = Vector3 {-camera_world[2].x, -camera_world[2].y, -camera_world[2].z};
+
     const auto frustum = camera->GetFrustum();
+
+    if (incremental_) {
+        ProcessTracked(scene, frustum);
+        return;
+    }
+
     for (const auto& child : scene->Children()) {
         ProcessNode(child.get(), frustum);
     }
 
-    const auto c = camera->GetWorldPosition();
-    const auto f = camera->Forward();
-    const auto compare = [&](auto* renderable) {
-        return Dot(renderable->GetWorldPosition() - c, f);
-    };
+    CullCandidates(frustum);
 
     // Sort opaque renderables front-to-back to optimize depth buffer writes.
-    std::ranges::stable_sort(opaque_, std::ranges::less {}, compare);
+    stable_sort(frame_->opaque, frame_->sort_scratch, std::ranges::less {});
 
     // Sort transparent renderables back-to-front to ensure correct blending.
-    std::ranges::stable_sort(transparent_, std::ranges::greater {}, compare);
+    stable_sort(frame_->transparent, frame_->sort_scratch, std::ranges::greater {});
 }
 
 auto RenderLists::ProcessNode(Node* node, const Frustum& frustum) -> void {
-    const auto type = node->GetNodeType();
-
     if (node->IsRenderable()) {
-        auto renderable = static_cast<Renderable*>(node);
-        auto material = renderable->GetMaterial();
-
-        if (!material->visible) return;
-        if (!Renderable::CanRender(renderable)) return;
-        if (!Renderable::InFrustum(renderable, frustum)) return;
-
-        renderable->GetMaterial()->transparent
-            ? transparent_.emplace_back(renderable)
-            : opaque_.emplace_back(renderable);
+        const auto index = frame_->candidates.size();
+        AddCandidate(
+            static_cast<Renderable*>(node),
+            index < cull_planes_.size() ? cull_planes_[index] : 0
+        );
     }
 
-    if (type == Node::Type::Light) {
+    if (node->GetNodeType() == Node::Type::Light) {
         lights_.emplace_back(static_cast<Light*>(node));
     }
 
@@ -61,10 +141,197 @@ auto RenderLists::ProcessNode(Node* node, const Frustum& frustum) -> void {
     }
 }
 
+auto RenderLists::AddCandidate(Renderable* renderable, uint8_t cull_plane) -> bool {
+    auto material = renderable->GetMaterial();
+
+    if (material && !material->visible) return false;
+    if (!Renderable::CanRender(renderable)) return false;
+
+    const auto& world = renderable->CachedWorldTransform();
+    auto bounding_sphere = renderable->BoundingSphere();
+    bounding_sphere.ApplyTransform(world);
+
+    const auto position = Vector3 {world[3].x, world[3].y, world[3].z};
+    auto& frame = *frame_;
+    frame.candidates.emplace_back(Candidate {
+        .renderable = renderable,
+        .radius = bounding_sphere.radius,
+        .depth = Dot(position - camera_position_, camera_forward_)
+    });
+    frame.cull_planes.emplace_back(cull_plane);
+
+    // An infinite radius keeps nodes that opted out of culling visible.
+    const auto& c = bounding_sphere.center;
+    frame.xs.emplace_back(c.x);
+    frame.ys.emplace_back(c.y);
+    frame.zs.emplace_back(c.z);
+    frame.rs.emplace_back(renderable->frustum_culled
+        ? bounding_sphere.radius
+        : std::numeric_limits<float>::infinity()
+    );
+
+    return true;
+}
+
+auto RenderLists::CullCandidates(const Frustum& frustum) -> void {
+    auto& frame = *frame_;
+    frame.visible.resize((frame.candidates.size() + 31) / 32);
+    frustum.CullSpheres(frame.xs, frame.ys, frame.zs, frame.rs, frame.visible, frame.cull_planes);
+
+    for (auto i = 0uz; i < frame.candidates.size(); ++i) {
+        const auto& candidate = frame.candidates[i];
+        const auto renderable = candidate.renderable;
+        if (frame.visible[i / 32] & (1u << (i % 32))) {
+            auto& list = renderable->GetMaterial()->transparent
+                ? frame.transparent
+                : frame.opaque;
+            list.emplace_back(RenderItem {
+                .renderable = renderable,
+                .world_transform = renderable->CachedWorldTransform(),
+                .bounding_sphere = {{frame.xs[i], frame.ys[i], frame.zs[i]}, candidate.radius},
+                .depth = candidate.depth,
+                .cull_plane = frame.cull_planes[i]
+            });
+        } else if (incremental_) {
+            frame.skipped.emplace_back(renderable, renderable->Id(), frame.cull_planes[i]);
+        }
+    }
+
+    if (!incremental_) {
+        cull_planes_.assign(frame.cull_planes.begin(), frame.cull_planes.end());
+    }
+}
+
+auto RenderLists::ProcessTracked(Scene* scene, const Frustum& frustum) -> void {
+    if (scene != scene_ || scene->Id() != scene_id_) {
+        renderables_.clear();
+        lights_.clear();
+        tracked_.clear();
+        pending_removals_.clear();
+        scene_ = scene;
+        scene_id_ = scene->Id();
+        for (const auto& child : scene->Children()) {
+            Track(child.get());
+        }
+    }
+
+    // Entries of removed renderables may point to destroyed nodes, so they
+    // are matched by the id captured when they were tracked.
+    if (!pending_removals_.empty()) {
+        std::erase_if(renderables_, [this](const TrackedRenderable& tracked) {
+            return pending_removals_.contains(tracked.id);
+        });
+        pending_removals_.clear();
+    }
+
+    // Renderables are visited in last frame's sorted order, so each list
+    // is already close to sorted before the adaptive sort runs.
+    for (const auto& tracked : renderables_) {
+        if (!AddCandidate(tracked.renderable, tracked.cull_plane)) {
+            frame_->skipped.emplace_back(tracked);
+        }
+    }
+    CullCandidates(frustum);
+
+    // Sort opaque renderables front-to-back to optimize depth buffer writes.
+    adaptive_sort(frame_->opaque, frame_->sort_scratch, std::ranges::less {});
+
+    // Sort transparent renderables back-to-front to ensure correct blending.
+    adaptive_sort(frame_->transparent, frame_->sort_scratch, std::ranges::greater {});
+
+    const auto& frame = *frame_;
+    const auto track = [this](const RenderItem& item) {
+        renderables_.emplace_back(item.renderable, item.renderable->Id(), item.cull_plane);
+    };
+    renderables_.clear();
+    for (const auto& item : frame.opaque) track(item);
+    for (const auto& item : frame.transparent) track(item);
+    renderables_.insert(renderables_.end(), frame.skipped.begin(), frame.skipped.end());
+}
+
+auto RenderLists::OnSceneEvent(Event* event) -> void {
+    if (event->GetType() != Event::Type::Scene || scene_ == nullptr) return;
+
+    auto e = static_cast<SceneEvent*>(event);
+    if (!in_scene(e->node.get(), scene_)) return;
+
+    e->type == SceneEvent::Type::NodeAdded
+        ? Track(e->node.get())
+        : Untrack(e->node.get());
+}
+
+auto RenderLists::Track(Node* node) -> void {
+    const auto is_light = node->GetNodeType() == Node::Type::Light;
+    if ((node->IsRenderable() || is_light) && tracked_.insert(node->Id()).second) {
+        if (is_light) {
+            lights_.emplace_back(static_cast<Light*>(node));
+        } else if (!pending_removals_.erase(node->Id())) {
+            // A renderable removed and re-added before the next frame is
+            // still listed.
+            renderables_.emplace_back(static_cast<Renderable*>(node), node->Id());
+        }
+    }
+
+    for (const auto& child : node->Children()) {
+        Track(child.get());
+    }
+}
+
+auto RenderLists::Untrack(Node* node) -> void {
+    // Lights are few, so they are dropped right away. Renderables are
+    // compacted in one pass on the next frame, and the node may be destroyed
+    // before then, so only its id is kept.
+    if (tracked_.erase(node->Id())) {
+        if (node->GetNodeType() == Node::Type::Light) {
+            std::erase(lights_, static_cast<Light*>(node));
+        } else {
+            pending_removals_.insert(node->Id());
+        }
+    }
+
+    for (const auto& child : node->Children()) {
+        Untrack(child.get());
+    }
+}
+
 auto RenderLists::Reset() -> void {
-    opaque_.clear();
-    transparent_.clear();
-    lights_.clear();
+    const auto& last = *frame_;
+    const auto candidates = last.candidates.size();
+    const auto opaque = last.opaque.size();
+    const auto transparent = last.transparent.size();
+    const auto skipped = last.skipped.size();
+
+    // The previous lists belong to the arena that stays alive for one more
+    // frame; they are dropped rather than cleared so that nothing allocated
+    // from the arena being rewound is reused.
+    arena_.BeginFrame();
+    frame_.reset();
+    auto& frame = frame_.emplace(arena_.Resource());
+
+    // Sized from the last frame, since growing a vector in a bump arena
+    // abandons its previous storage until the arena is rewound.
+    frame.candidates.reserve(candidates);
+    frame.xs.reserve(candidates);
+    frame.ys.reserve(candidates);
+    frame.zs.reserve(candidates);
+    frame.rs.reserve(candidates);
+    frame.cull_planes.reserve(candidates);
+    frame.visible.reserve((candidates + 31) / 32);
+    frame.opaque.reserve(opaque);
+    frame.transparent.reserve(transparent);
+    frame.sort_scratch.reserve(std::max(opaque, transparent));
+    frame.skipped.reserve(skipped);
+
+    if (!incremental_) {
+        lights_.clear();
+    }
 }
 
-}
\ No newline at end of file
+RenderLists::~RenderLists() {
+    if (event_listener_) {
+        EventDispatcher::Get().RemoveEventListener("node_added", event_listener_);
+        EventDispatcher::Get().RemoveEventListener("node_removed", event_listener_);
+    }
+}
+
+}
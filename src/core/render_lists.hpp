@@ -10,42 +10,194 @@
 #include "vglx/cameras/camera.hpp"
 #include "vglx/lights/light.hpp"
 #include "vglx/math/frustum.hpp"
+#include "vglx/math/matrix4.hpp"
+#include "vglx/math/sphere.hpp"
 #include "vglx/nodes/node.hpp"
 #include "vglx/nodes/renderable.hpp"
 #include "vglx/nodes/scene.hpp"
 
+#include "events/event_dispatcher.hpp"
+#include "utilities/frame_arena.hpp"
+
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <span>
+#include <unordered_set>
 #include <vector>
 
 namespace vglx {
 
+/**
+ * Per-frame snapshot of a visible renderable. World data is captured once
+ * while the scene is traversed so that sorting and drawing never have to
+ * walk the node hierarchy again.
+ */
+struct RenderItem {
+    Renderable* renderable;
+
+    Matrix4 world_transform;
+
+    Sphere bounding_sphere;
+
+    float depth;
+
+    // Frustum plane that last rejected the renderable, tested first next frame.
+    uint8_t cull_plane {0};
+};
+
+/**
+ * Builds the sorted opaque and transparent lists and the light list for a frame.
+ *
+ * In incremental mode the lists are not rebuilt from a scene traversal every
+ * frame. Renderables and lights are tracked through scene change events, the
+ * previous frame's ordering is kept, and the lists are re-sorted with an
+ * adaptive sort that is close to linear when the ordering barely changed.
+ *
+ * Lists that only live for one frame are allocated from a frame arena and
+ * dropped at the start of the next frame instead of being cleared, so once
+ * the arena has grown to fit the scene they never reach the global allocator.
+ */
 class RenderLists {
 public:
+    explicit RenderLists(bool incremental = false);
+
+    RenderLists(const RenderLists&) = delete;
+    auto operator=(const RenderLists&) -> RenderLists& = delete;
+
     auto ProcessScene(Scene* scene, Camera* camera) -> void;
 
-    [[nodiscard]] auto Opaque() const -> std::span<Renderable* const> {
-        return opaque_;
+    [[nodiscard]] auto Opaque() const -> std::span<const RenderItem> {
+        return frame_->opaque;
     }
 
-    [[nodiscard]] auto Transparent() const -> std::span<Renderable* const> {
-        return transparent_;
+    [[nodiscard]] auto Transparent() const -> std::span<const RenderItem> {
+        return frame_->transparent;
     }
 
     [[nodiscard]] auto Lights() const -> std::span<Light* const> {
         return lights_;
     }
 
+    [[nodiscard]] auto Incremental() const { return incremental_; }
+
+    /// Number of renderables rejected by frustum culling this frame.
+    [[nodiscard]] auto Culled() const {
+        return frame_->candidates.size() - frame_->opaque.size() - frame_->transparent.size();
+    }
+
+    ~RenderLists();
+
 private:
-    std::vector<Renderable*> opaque_;
+    struct Candidate {
+        Renderable* renderable;
+
+        // Radius of the world space bounding sphere. The culling radius in
+        // `rs` is infinite for renderables that opted out of culling.
+        float radius;
+
+        float depth;
+    };
+
+    // Incremental mode state. Nodes are identified by id rather than
+    // address, since a removed node can be destroyed and its address reused
+    // by a new node before the next frame.
+    struct TrackedRenderable {
+        Renderable* renderable;
+
+        uint64_t id;
+
+        uint8_t cull_plane {0};
+    };
+
+    // Lists rebuilt every frame on the frame arena.
+    struct FrameLists {
+        explicit FrameLists(std::pmr::memory_resource* resource)
+          : opaque(resource),
+            transparent(resource),
+            candidates(resource),
+            xs(resource),
+            ys(resource),
+            zs(resource),
+            rs(resource),
+            cull_planes(resource),
+            visible(resource),
+            sort_scratch(resource),
+            skipped(resource) {}
+
+        std::pmr::vector<RenderItem> opaque;
+
+        std::pmr::vector<RenderItem> transparent;
+
+        // Candidates that passed render checks, culled in one batch per frame.
+        // Render items are only built for the ones that turn out visible.
+        std::pmr::vector<Candidate> candidates;
+
+        std::pmr::vector<float> xs;
+
+        std::pmr::vector<float> ys;
 
-    std::vector<Renderable*> transparent_;
+        std::pmr::vector<float> zs;
+
+        std::pmr::vector<float> rs;
+
+        std::pmr::vector<uint8_t> cull_planes;
+
+        std::pmr::vector<uint32_t> visible;
+
+        // Merge buffer for sorting. Results are copied back into the sorted
+        // list rather than swapped, so each list keeps its own capacity.
+        std::pmr::vector<RenderItem> sort_scratch;
+
+        // Incremental mode renderables that were not drawn this frame.
+        std::pmr::vector<TrackedRenderable> skipped;
+    };
+
+    FrameArena arena_;
+
+    std::optional<FrameLists> frame_;
 
     std::vector<Light*> lights_;
 
+    Vector3 camera_position_;
+
+    Vector3 camera_forward_;
+
+    bool incremental_ {false};
+
+    // Culling hints for full rebuilds, indexed by traversal order. A stale
+    // hint after the scene changed only costs an extra plane test.
+    std::vector<uint8_t> cull_planes_;
+
+    // Incremental mode state.
+    std::vector<TrackedRenderable> renderables_;
+
+    std::unordered_set<uint64_t> tracked_;
+
+    std::unordered_set<uint64_t> pending_removals_;
+
+    std::shared_ptr<EventListener> event_listener_;
+
+    Scene* scene_ {nullptr};
+
+    uint64_t scene_id_ {0};
+
     auto ProcessNode(Node* node, const Frustum& frustum) -> void;
 
+    auto AddCandidate(Renderable* renderable, uint8_t cull_plane) -> bool;
+
+    auto CullCandidates(const Frustum& frustum) -> void;
+
+    auto ProcessTracked(Scene* scene, const Frustum& frustum) -> void;
+
+    auto OnSceneEvent(Event* event) -> void;
+
+    auto Track(Node* node) -> void;
+
+    auto Untrack(Node* node) -> void;
+
     auto Reset() -> void;
 };
 
-}
\ No newline at end of file
+}
@@ -26,6 +26,14 @@ auto Renderer::Render(Scene* scene, Camera* camera) -> void {
     impl_->Render(scene, camera);
 }
 
+auto Renderer::Compile(Scene* scene, Camera* camera) -> void {
+    impl_->Compile(scene, camera);
+}
+
+auto Renderer::PendingPrograms() -> size_t {
+    return impl_->PendingPrograms();
+}
+
 auto Renderer::SetViewport(int x, int y, int width, int height) -> void {
     impl_->SetViewport(x, y, width, height);
 }
@@ -38,6 +46,22 @@ auto Renderer::RenderedObjectsPerFrame() const -> size_t {
     return impl_->RenderedObjectsPerFrame();
 }
 
+auto Renderer::GetFrameStats() const -> FrameStats {
+    return impl_->GetFrameStats();
+}
+
+auto Renderer::GetGPUTimings() const -> GPUTimings {
+    return impl_->GetGPUTimings();
+}
+
+auto Renderer::BeginUIPass() -> void {
+    impl_->BeginUIPass();
+}
+
+auto Renderer::EndUIPass() -> void {
+    impl_->EndUIPass();
+}
+
 Renderer::~Renderer() = default;
 
 }
\ No newline at end of file
@@ -35,10 +35,10 @@ auto ShaderLibrary::GetShaderSource(const ProgramAttributes& attrs) const -> std
     if (attrs.type == Material::Type::PhongMaterial) {
         return {{
             ShaderType::kVertexShader,
-            ProcessShader(attrs, _SHADER_phong_material_vert)
+            BuildShader(attrs, _SHADER_phong_material_vert_preamble, _SHADER_phong_material_vert)
         }, {
             ShaderType::kFragmentShader,
-            ProcessShader(attrs, _SHADER_phong_material_frag)
+            BuildShader(attrs, _SHADER_phong_material_frag_preamble, _SHADER_phong_material_frag)
         }};
     }
 
@@ -55,20 +55,20 @@ auto ShaderLibrary::GetShaderSource(const ProgramAttributes& attrs) const -> std
     if (attrs.type == Material::Type::SpriteMaterial) {
         return {{
             ShaderType::kVertexShader,
-            ProcessShader(attrs, _SHADER_sprite_material_vert)
+            BuildShader(attrs, _SHADER_sprite_material_vert_preamble, _SHADER_sprite_material_vert)
         }, {
             ShaderType::kFragmentShader,
-            ProcessShader(attrs, _SHADER_sprite_material_frag)
+            BuildShader(attrs, _SHADER_sprite_material_frag_preamble, _SHADER_sprite_material_frag)
         }};
     }
 
     if (attrs.type == Material::Type::UnlitMaterial) {
         return {{
             ShaderType::kVertexShader,
-            ProcessShader(attrs, _SHADER_unlit_material_vert)
+            BuildShader(attrs, _SHADER_unlit_material_vert_preamble, _SHADER_unlit_material_vert)
         }, {
             ShaderType::kFragmentShader,
-            ProcessShader(attrs, _SHADER_unlit_material_frag)
+            BuildShader(attrs, _SHADER_unlit_material_frag_preamble, _SHADER_unlit_material_frag)
         }};
     }
 
@@ -81,6 +81,22 @@ auto ShaderLibrary::GetShaderSource(const ProgramAttributes& attrs) const -> std
     return {};
 }
 
+auto ShaderLibrary::BuildShader(
+    const ProgramAttributes& attrs,
+    std::string_view preamble,
+    std::string_view body
+) const -> std::string {
+    // Includes were expanded and the source split at the injection point
+    // when the shader headers were generated, so this only concatenates.
+    const auto features = Features(attrs);
+    auto output = std::string {};
+    output.reserve(preamble.size() + features.size() + body.size());
+    output += preamble;
+    output += features;
+    output += body;
+    return output;
+}
+
 auto ShaderLibrary::ProcessShader(
     const ProgramAttributes& attrs,
     std::string_view source
@@ -91,11 +107,9 @@ auto ShaderLibrary::ProcessShader(
     return output;
 }
 
-auto ShaderLibrary::InjectAttributes(
-    const ProgramAttributes& attrs,
-    std::string& source
-) const -> void {
+auto ShaderLibrary::Features(const ProgramAttributes& attrs) const -> std::string {
     auto features = std::string {};
+    features.reserve(256);
 
     if (attrs.color) features += "#define USE_COLOR\n";
     if (attrs.flat_shaded) features += "#define USE_FLAT_SHADED\n";
@@ -110,9 +124,18 @@ auto ShaderLibrary::InjectAttributes(
     if (attrs.normal_map && attrs.tangent) features += "#define USE_NORMAL_MAP\n";
     if (attrs.texture_map) features += "#define USE_TEXTURE_MAP\n";
 
-    const auto lights = attrs.num_lights;
-    features += "#define NUM_LIGHTS " + std::to_string(lights) + '\n';
+    if (attrs.dynamic_lights) features += "#define USE_DYNAMIC_LIGHTS\n";
+    features += "#define NUM_LIGHTS ";
+    features += std::to_string(attrs.num_lights);
+    features += '\n';
+
+    return features;
+}
 
+auto ShaderLibrary::InjectAttributes(
+    const ProgramAttributes& attrs,
+    std::string& source
+) const -> void {
     const auto token = std::string_view {"#pragma inject_attributes"};
     const auto pos = source.find(token);
     if (pos == std::string::npos) {
@@ -124,10 +147,11 @@ auto ShaderLibrary::InjectAttributes(
         return;
     }
 
-    source.replace(pos, token.size(), features);
+    source.replace(pos, token.size(), Features(attrs));
 }
 
 auto ShaderLibrary::ResolveIncludes(std::string& source) const -> void {
+    // Only shader materials get here, built-in shaders are expanded at build time
     static const std::unordered_map<std::string, std::string> include_map = {
         {"snippets/frag_global_fog.glsl", _SNIPPET_frag_global_fog},
         {"snippets/frag_global_params.glsl", _SNIPPET_frag_global_params},
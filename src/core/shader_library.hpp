@@ -29,6 +29,14 @@ public:
     auto GetShaderSource(const ProgramAttributes& attrs) const -> std::vector<ShaderInfo>;
 
 private:
+    auto BuildShader(
+        const ProgramAttributes& attrs,
+        std::string_view preamble,
+        std::string_view body
+    ) const -> std::string;
+
+    auto Features(const ProgramAttributes& attrs) const -> std::string;
+
     auto ProcessShader(const ProgramAttributes& attrs, std::string_view source) const -> std::string;
 
     auto InjectAttributes(const ProgramAttributes& attrs, std::string& source) const -> void;
@@ -52,6 +52,7 @@ auto Window::Impl::Initialize() -> std::expected<void, std::string> {
     glfwWindowHint(GLFW_DEPTH_BITS, 24);
     glfwWindowHint(GLFW_STENCIL_BITS, 8);
     glfwWindowHint(GLFW_SAMPLES, params_.antialiasing);
+    glfwWindowHint(GLFW_VISIBLE, params_.visible ? GLFW_TRUE : GLFW_FALSE);
 
     #ifdef __APPLE__
         glfwWindowHint(GLFW_COCOA_RETINA_FRAMEBUFFER, GLFW_TRUE);
@@ -89,6 +90,7 @@ auto Window::Impl::Initialize() -> std::expected<void, std::string> {
 
 #ifdef VGLX_USE_IMGUI
     imgui_initialize(window_);
+    ui_initialized_ = true;
 #endif
 
     return {};
@@ -157,7 +159,7 @@ auto Window::Impl::LogContextInfo() const -> void {
 
 Window::Impl::~Impl() {
 #ifdef VGLX_USE_IMGUI
-    imgui_shutdown();
+    if (ui_initialized_) imgui_shutdown();
 #endif
 
     if (window_) {
@@ -65,6 +65,8 @@ private:
 
     bool should_close_ {false};
 
+    bool ui_initialized_ {false};
+
     auto LogContextInfo() const -> void;
 };
 
@@ -14,6 +14,7 @@
 #include "vglx/nodes/mesh.hpp"
 #include "vglx/nodes/node.hpp"
 #include "vglx/textures/texture_2d.hpp"
+#include "vglx/utilities/profiler.hpp"
 
 #include "utilities/logger.hpp"
 #include "utilities/file.hpp"
@@ -147,6 +148,8 @@ auto load_mesh(const fs::path& path, std::ifstream& file, const MeshHeader& mesh
 } // unnamed namespace
 
 auto MeshLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Node> {
+    VGLX_PROFILE_SCOPE("MeshLoader::Load");
+
     auto file = std::ifstream {path, std::ios::binary};
     auto path_s = path.string();
     if (!file) {
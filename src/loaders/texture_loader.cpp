@@ -7,6 +7,7 @@
 
 #include "vglx/asset_format.hpp"
 #include "vglx/loaders/texture_loader.hpp"
+#include "vglx/utilities/profiler.hpp"
 
 #include "utilities/file.hpp"
 
@@ -34,6 +35,8 @@ auto load_texture(const fs::path& path, std::ifstream& file, const TextureHeader
 }
 
 auto TextureLoader::LoadImpl(const fs::path& path) const -> LoaderResult<Texture2D> {
+    VGLX_PROFILE_SCOPE("TextureLoader::Load");
+
     auto file = std::ifstream {path, std::ios::binary};
     auto path_s = path.string();
     if (!file) {
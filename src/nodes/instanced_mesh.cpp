@@ -10,6 +10,7 @@
 #include "nodes/instanced_mesh_impl.hpp"
 
 #include <cassert>
+#include <span>
 
 namespace vglx {
 
@@ -54,12 +55,10 @@ auto InstancedMesh::BoundingBox() -> Box3 {
     if (impl_->bounding_box_touched) {
         const auto base = GetGeometry()->BoundingBox();
         if (!base.IsEmpty() && count_ > 0) {
-            impl_->bounding_box.Reset();
-            for (auto i = 0; i < count_; ++i) {
-                auto box = base;
-                box.ApplyTransform(GetTransformAt(i));
-                impl_->bounding_box.Union(box);
-            }
+            impl_->bounding_box = TransformedUnion(
+                base,
+                std::span {transforms_}.first(count_)
+            );
         }
         impl_->bounding_box_touched = false;
     }
@@ -70,12 +69,10 @@ auto InstancedMesh::BoundingSphere() -> Sphere {
     if (impl_->bounding_sphere_touched) {
         const auto base = GetGeometry()->BoundingSphere();
         if (!base.IsEmpty() && count_ > 0) {
-            impl_->bounding_sphere.Reset();
-            for (auto i = 0; i < count_; ++i) {
-                auto sphere = base;
-                sphere.ApplyTransform(GetTransformAt(i));
-                impl_->bounding_sphere.Union(sphere);
-            }
+            impl_->bounding_sphere = TransformedUnion(
+                base,
+                std::span {transforms_}.first(count_)
+            );
         }
         impl_->bounding_sphere_touched = false;
     }
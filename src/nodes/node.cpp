@@ -13,7 +13,6 @@
 #include "utilities/logger.hpp"
 
 #include <queue>
-#include <ranges>
 
 namespace vglx {
 
@@ -22,6 +21,8 @@ struct Node::Impl {
 
     Node* parent {nullptr};
 
+    size_t sibling_index {0};
+
     Matrix4 world_transform {1.0f};
 
     bool world_transform_touched {false};
@@ -41,6 +42,7 @@ auto Node::Add(const std::shared_ptr<Node>& node) -> void {
         node->impl_->parent->Remove(node);
     }
     node->impl_->parent = this;
+    node->impl_->sibling_index = impl_->children.size();
     impl_->children.emplace_back(node);
 
     EventDispatcher::Get().Dispatch(
@@ -55,19 +57,38 @@ auto Node::Remove(const std::shared_ptr<Node>& node) -> void {
         return;
     }
 
-    auto it = std::ranges::find(impl_->children, node);
-    if (it != impl_->children.end()) {
-        EventDispatcher::Get().Dispatch(
-            "node_removed",
-            std::make_unique<SceneEvent>(SceneEvent::Type::NodeRemoved, node)
-        );
-        impl_->children.erase(it);
-        node->impl_->parent = nullptr;
-        node->impl_->attached = false;
-        node->transform.touched = true;
-    } else {
+    if (node->impl_->parent != this) {
         Logger::Log(LogLevel::Warning, "Attempting to remove node that is not in scene {}", *node);
+        return;
     }
+
+    // Keep the child alive; the reference may point into the children vector.
+    const auto child = node;
+
+    EventDispatcher::Get().Dispatch(
+        "node_removed",
+        std::make_unique<SceneEvent>(SceneEvent::Type::NodeRemoved, child)
+    );
+
+    auto& children = impl_->children;
+    const auto index = child->impl_->sibling_index;
+    if (preserve_child_order) {
+        children.erase(children.begin() + index);
+        for (auto i = index; i < children.size(); ++i) {
+            children[i]->impl_->sibling_index = i;
+        }
+    } else {
+        if (index != children.size() - 1) {
+            children[index] = std::move(children.back());
+            children[index]->impl_->sibling_index = index;
+        }
+        children.pop_back();
+    }
+
+    child->impl_->parent = nullptr;
+    child->impl_->sibling_index = 0;
+    child->impl_->attached = false;
+    child->transform.touched = true;
 }
 
 auto Node::RemoveAllChildren() -> void {
@@ -77,6 +98,7 @@ auto Node::RemoveAllChildren() -> void {
             std::make_unique<SceneEvent>(SceneEvent::Type::NodeRemoved, node)
         );
         node->impl_->parent = nullptr;
+        node->impl_->sibling_index = 0;
         node->impl_->attached = false;
         node->transform.touched = true;
     }
@@ -165,6 +187,10 @@ auto Node::GetWorldTransform() -> Matrix4 {
     return impl_->world_transform;
 }
 
+auto Node::CachedWorldTransform() const -> const Matrix4& {
+    return impl_->world_transform;
+}
+
 Node::~Node() = default;
 
 auto Node::LookAt(const Vector3& target) -> void {
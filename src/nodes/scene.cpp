@@ -14,12 +14,13 @@ namespace vglx {
 
 namespace {
 
-auto handle_node_updates(std::weak_ptr<Node> node, float delta) -> void {
-    if (const auto n = node.lock()) {
-        n->OnUpdate(delta);
-        for (const auto& child : n->Children()) {
-            handle_node_updates(child, delta);
-        }
+auto handle_node_updates(const std::shared_ptr<Node>& node, float delta) -> void {
+    // A single reference keeps the node alive if its update detaches it,
+    // without the extra reference counting of going through a weak_ptr.
+    const auto n = node;
+    n->OnUpdate(delta);
+    for (const auto& child : n->Children()) {
+        handle_node_updates(child, delta);
     }
 }
 
@@ -8,8 +8,10 @@
 #include "renderer/gl/gl_buffers.hpp"
 
 #include "vglx/math/vector4.hpp"
+#include "vglx/utilities/profiler.hpp"
 
 #include "nodes/instanced_mesh_impl.hpp"
+#include "renderer/gl/gl_timer_queries.hpp"
 #include "utilities/logger.hpp"
 
 #include <cstdint>
@@ -40,9 +42,13 @@ auto GLBuffers::Bind(const std::shared_ptr<Geometry>& geometry) -> void {
 
     glBindVertexArray(vao);
     current_vao_ = vao;
+    ++stats_->vao_binds;
 }
 
 auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
+    VGLX_PROFILE_SCOPE("GLBuffers::Upload");
+    const auto gpu_timer = GLTimerScope {timer_queries_, GPUPhase::Uploads};
+
     auto& vao = geometry->renderer_id;
     auto buffers = std::array<GLuint, 4> {};
 
@@ -58,6 +64,7 @@ auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
         vertex.data(),
         GL_STATIC_DRAW
     );
+    stats_->buffer_upload_bytes += vertex.size() * sizeof(GLfloat);
 
     auto offset = 0;
     auto stride = 0;
@@ -90,6 +97,7 @@ auto GLBuffers::GenerateBuffers(Geometry* geometry) -> void {
             index.data(),
             GL_STATIC_DRAW
         );
+        stats_->buffer_upload_bytes += index.size() * sizeof(GLuint);
     }
 
     bindings_.try_emplace(vao, std::move(buffers));
@@ -125,6 +133,8 @@ auto GLBuffers::BindInstancedMesh(InstancedMesh* mesh) -> void {
     }
 
     if (mesh->impl_->transforms_touched) {
+        VGLX_PROFILE_SCOPE("GLBuffers::UploadInstanceTransforms");
+        const auto gpu_timer = GLTimerScope {timer_queries_, GPUPhase::Uploads};
         glBindBuffer(GL_ARRAY_BUFFER, mesh->impl_->transforms_buff_id);
         glBufferData(
             GL_ARRAY_BUFFER,
@@ -132,6 +142,7 @@ auto GLBuffers::BindInstancedMesh(InstancedMesh* mesh) -> void {
             mesh->transforms_.data(),
             GL_DYNAMIC_DRAW
         );
+        stats_->buffer_upload_bytes += mesh->transforms_.size() * 4 * sizeof(Vector4);
         mesh->impl_->transforms_touched = false;
     }
 
@@ -154,6 +165,8 @@ auto GLBuffers::BindInstancedMesh(InstancedMesh* mesh) -> void {
     }
 
     if (mesh->impl_->colors_touched) {
+        VGLX_PROFILE_SCOPE("GLBuffers::UploadInstanceColors");
+        const auto gpu_timer = GLTimerScope {timer_queries_, GPUPhase::Uploads};
         glBindBuffer(GL_ARRAY_BUFFER, mesh->impl_->colors_buff_id);
 
         glBufferData(
@@ -162,6 +175,7 @@ auto GLBuffers::BindInstancedMesh(InstancedMesh* mesh) -> void {
             mesh->colors_.data(),
             GL_DYNAMIC_DRAW
         );
+        stats_->buffer_upload_bytes += mesh->colors_.size() * sizeof(Color);
         mesh->impl_->colors_touched = false;
     }
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "vglx/core/renderer.hpp"
 #include "vglx/geometries/geometry.hpp"
 #include "vglx/nodes/instanced_mesh.hpp"
 
@@ -20,9 +21,13 @@
 
 namespace vglx {
 
+class GLTimerQueries;
+
 class GLBuffers {
 public:
-    GLBuffers() = default;
+    GLBuffers(GLTimerQueries* timer_queries, Renderer::FrameStats* stats) :
+        timer_queries_(timer_queries),
+        stats_(stats) {}
 
     GLBuffers(const GLBuffers&) = delete;
     GLBuffers(GLBuffers&&) = delete;
@@ -36,6 +41,10 @@ public:
     ~GLBuffers();
 
 private:
+    GLTimerQueries* timer_queries_;
+
+    Renderer::FrameStats* stats_;
+
     std::unordered_map<GLuint, std::array<GLuint, 4>> bindings_;
 
     std::vector<std::weak_ptr<Geometry>> geometries_;
@@ -96,6 +96,7 @@ auto GLLights::AddLight(Light* light, Camera* camera) -> void {
 }
 
 auto GLLights::Update() -> void {
+    lights_.count = static_cast<int>(idx_);
     uniform_buffer_.UploadIfNeeded(&lights_, sizeof(lights_));
 }
 
@@ -105,6 +106,7 @@ auto GLLights::HasLights() const -> bool {
 
 auto GLLights::Reset() -> void {
     idx_ = 0;
+    ambient_light = 0x000000;
     ambient = 0;
     directional = 0;
     point = 0;
@@ -38,6 +38,7 @@ public:
 
     struct alignas(16) UniformLights {
         alignas(16) UniformLight lights[kMaxLights];
+        alignas(4)  int count {0};
     };
 
     Color ambient_light {0x000000};
@@ -0,0 +1,91 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_objects.hpp"
+
+#include "vglx/materials/phong_material.hpp"
+#include "vglx/materials/sprite_material.hpp"
+#include "vglx/materials/unlit_material.hpp"
+#include "vglx/nodes/sprite.hpp"
+#include "vglx/textures/texture_2d.hpp"
+
+#include <cstring>
+
+namespace vglx {
+
+namespace {
+
+auto set_texture_transform(GLObjects::UniformObject& block, Texture2D* texture) {
+    if (!texture) return;
+    const auto transform = texture->GetTransform();
+    for (auto i = 0; i < 3; ++i) {
+        block.texture_transform[i] = {transform[i].x, transform[i].y, transform[i].z, 0.0f};
+    }
+}
+
+}
+
+auto GLObjects::TextureTransformMap(Material* material, const ProgramAttributes& attrs) -> Texture2D* {
+    if (attrs.type == Material::Type::PhongMaterial) {
+        auto m = static_cast<PhongMaterial*>(material);
+        if (attrs.specular_map) return m->specular_map.get();
+        if (attrs.normal_map) return m->normal_map.get();
+        if (attrs.alpha_map) return m->alpha_map.get();
+        if (attrs.albedo_map) return m->albedo_map.get();
+    }
+
+    if (attrs.type == Material::Type::SpriteMaterial) {
+        auto m = static_cast<SpriteMaterial*>(material);
+        if (attrs.texture_map) return m->texture_map.get();
+    }
+
+    if (attrs.type == Material::Type::UnlitMaterial) {
+        auto m = static_cast<UnlitMaterial*>(material);
+        if (attrs.alpha_map) return m->alpha_map.get();
+        if (attrs.texture_map) return m->texture_map.get();
+    }
+
+    return nullptr;
+}
+
+auto GLObjects::Write(std::size_t index, const RenderItem& item, const ProgramAttributes& attrs) -> void {
+    if (!mapped_) return;
+
+    auto renderable = item.renderable;
+    auto material = renderable->GetMaterial().get();
+    auto block = UniformObject {};
+    block.model = item.world_transform;
+    block.opacity = material->opacity;
+
+    if (attrs.type == Material::Type::PhongMaterial) {
+        auto m = static_cast<PhongMaterial*>(material);
+        block.color = m->color;
+        block.specular = m->specular;
+        block.shininess = m->shininess;
+    }
+
+    if (attrs.type == Material::Type::SpriteMaterial) {
+        auto m = static_cast<SpriteMaterial*>(material);
+        auto r = static_cast<Sprite*>(renderable);
+        block.color = m->color;
+        block.anchor = r->anchor;
+        block.rotation = r->rotation;
+    }
+
+    if (attrs.type == Material::Type::UnlitMaterial) {
+        auto m = static_cast<UnlitMaterial*>(material);
+        block.color = m->color;
+    }
+
+    // Shaders sample every map with the same transform
+    set_texture_transform(block, TextureTransformMap(material, attrs));
+
+    std::memcpy(mapped_ + index * ring_.Stride(), &block, sizeof(block));
+    ++stats_->object_uniform_writes;
+}
+
+}
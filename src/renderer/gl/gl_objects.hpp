@@ -0,0 +1,90 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/core/renderer.hpp"
+#include "vglx/math/color.hpp"
+#include "vglx/math/matrix4.hpp"
+#include "vglx/math/vector2.hpp"
+#include "vglx/math/vector4.hpp"
+
+#include "core/program_attributes.hpp"
+#include "core/render_lists.hpp"
+#include "renderer/gl/gl_uniform_ring.hpp"
+
+#include <cstddef>
+
+namespace vglx {
+
+class Texture2D;
+
+/**
+ * Per-draw uniforms for the ub_Object block.
+ *
+ * Every item in the frame's render lists gets a block written up front, and
+ * each draw binds its block by index instead of issuing glUniform calls.
+ */
+class GLObjects {
+public:
+    struct alignas(16) UniformObject {
+        alignas(16) Matrix4 model {Matrix4::Identity()};
+        alignas(16) Vector4 texture_transform[3] {
+            {1.0f, 0.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f, 0.0f}
+        };
+        alignas(16) Color color {0xFFFFFF};
+        alignas(4)  float opacity {1.0f};
+        alignas(16) Color specular {0x000000};
+        alignas(4)  float shininess {0.0f};
+        alignas(8)  Vector2 anchor {0.5f};
+        alignas(4)  float rotation {0.0f};
+    };
+
+    static_assert(sizeof(UniformObject) == 160, "UniformObject must match the std140 ub_Object layout");
+
+    explicit GLObjects(Renderer::FrameStats* stats) : stats_(stats) {}
+
+    /// Map whose transform the shaders sample every map with: the last map
+    /// the renderer binds for the material, following the same attributes.
+    [[nodiscard]] static auto TextureTransformMap(
+        Material* material,
+        const ProgramAttributes& attrs
+    ) -> Texture2D*;
+
+    auto Begin(std::size_t count) -> void {
+        mapped_ = ring_.Map(count);
+        written_ = mapped_ != nullptr;
+    }
+
+    auto Write(std::size_t index, const RenderItem& item, const ProgramAttributes& attrs) -> void;
+
+    auto End() -> void {
+        ring_.Unmap();
+        mapped_ = nullptr;
+    }
+
+    auto Bind(std::size_t index) -> void {
+        if (written_) ring_.Bind(index);
+    }
+
+    /// Whether this frame's blocks were written. When the ring could not be
+    /// mapped, the ring holds stale data that draws must not read.
+    [[nodiscard]] auto IsWritten() const { return written_; }
+
+private:
+    GLUniformRing ring_ {"ub_Object", sizeof(UniformObject)};
+
+    Renderer::FrameStats* stats_;
+
+    std::byte* mapped_ {nullptr};
+
+    bool written_ {false};
+};
+
+}
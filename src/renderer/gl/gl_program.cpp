@@ -27,53 +27,77 @@ const auto VertexAttributesMap = std::unordered_map<std::string, VertexAttribute
     {"a_InstanceTransform", VertexAttributeType::InstanceTransform},
 };
 
+// GL_COMPLETION_STATUS_KHR, shared with the ARB variant of the extension.
+// The bundled loader is generated without extensions.
+constexpr auto kCompletionStatus = GLenum {0x91B1};
+
 }
 
-GLProgram::GLProgram(const std::vector<ShaderInfo>& shaders) {
+GLProgram::GLProgram(const std::vector<ShaderInfo>& shaders, bool retrievable) {
     program_ = glCreateProgram();
+    if (retrievable) {
+        glProgramParameteri(program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
 
-    auto compilation_error = false;
+    // Status queries block until the driver finishes, so they are deferred
+    // to Resolve and every shader is compiled and linked up front.
     for (const auto& shader_info : shaders) {
         auto shader_id = glCreateShader(GetShaderType(shader_info.type));
         auto data = shader_info.source.data();
 
         glShaderSource(shader_id, 1, &data, nullptr);
         glCompileShader(shader_id);
-
-        if (!CheckShaderCompileStatus(shader_id)) {
-            compilation_error = true;
-            break;
-        }
-
         glAttachShader(program_, shader_id);
-        glDeleteShader(shader_id);
-    }
-
-    if (compilation_error) {
-        has_errors_ = true;
-        return;
+        shaders_.emplace_back(shader_id);
     }
 
     BindVertexAttributeLocations();
 
     glLinkProgram(program_);
-    if (!CheckProgramLinkStatus()) {
+    pending_ = true;
+}
+
+auto GLProgram::Resolve(bool wait) -> bool {
+    if (!pending_) return true;
+
+    if (!wait) {
+        auto complete = GLint {GL_TRUE};
+        glGetProgramiv(program_, kCompletionStatus, &complete);
+        if (complete == GL_FALSE) return false;
+    }
+
+    pending_ = false;
+    for (auto shader_id : shaders_) {
+        if (!CheckShaderCompileStatus(shader_id)) has_errors_ = true;
+        glDeleteShader(shader_id);
+    }
+    shaders_.clear();
+
+    if (has_errors_ || !CheckProgramLinkStatus()) {
         has_errors_ = true;
-        return;
+        return true;
     }
 
     ProcessUniforms();
     ProcessUniformBlocks();
+    return true;
+}
+
+GLProgram::GLProgram(GLuint program) : program_(program) {
+    ProcessUniforms();
+    ProcessUniformBlocks();
 }
 
-auto GLProgram::UpdateUniforms() -> void {
+auto GLProgram::UpdateUniforms() -> size_t {
+    auto uploads = size_t {0};
     for (auto& [_, uniform] : unknown_uniforms_) {
-        uniform.UploadIfNeeded();
+        uploads += uniform.UploadIfNeeded();
     }
 
     for (auto& uniform : uniforms_) {
-        if (uniform != nullptr) uniform->UploadIfNeeded();
+        if (uniform != nullptr) uploads += uniform->UploadIfNeeded();
     }
+    return uploads;
 }
 
 auto GLProgram::SetUnknownUniform(const std::string& name, const void* v) -> void {
@@ -124,10 +148,14 @@ auto GLProgram::ProcessUniforms() -> void {
 
         auto name = std::string(buffer.data(), length);
         auto idx = get_uniform_loc(name);
+        auto location = GetUniformLoc(name);
         if (idx != -1) {
-            uniforms_[idx] = std::make_unique<GLUniform>(name, GetUniformLoc(name), type);
+            // Members of ub_Object share names with the per-object uniforms
+            // but have no location, they are written through the block.
+            if (location == -1) continue;
+            uniforms_[idx] = std::make_unique<GLUniform>(name, location, type);
         } else {
-            unknown_uniforms_.try_emplace(name, name, GetUniformLoc(name), type);
+            unknown_uniforms_.try_emplace(name, name, location, type);
         }
     }
 }
@@ -150,6 +178,7 @@ auto GLProgram::ProcessUniformBlocks() -> void {
             continue;
         }
         glUniformBlockBinding(program_, i, idx);
+        if (idx == static_cast<int>(UniformBuffer::Object)) has_object_block_ = true;
     }
 }
 
@@ -191,6 +220,7 @@ auto GLProgram::GetShaderType(ShaderType type) const -> GLuint {
 }
 
 GLProgram::~GLProgram() {
+    for (auto shader_id : shaders_) glDeleteShader(shader_id);
     if (program_ > 0) glDeleteProgram(program_);
 }
 
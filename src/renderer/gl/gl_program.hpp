@@ -29,19 +29,37 @@ constexpr auto uniforms_len = static_cast<int>(Uniform::KnownUniformsLength);
 
 class GLProgram {
 public:
-    explicit GLProgram(const std::vector<ShaderInfo>& shaders);
+    /// Issues compilation and linking without waiting for the result; the
+    /// program is pending until @ref Resolve succeeds. A retrievable program
+    /// can be saved with `glGetProgramBinary` once linked.
+    explicit GLProgram(const std::vector<ShaderInfo>& shaders, bool retrievable = false);
+
+    /// Takes ownership of a program that is already linked, such as one
+    /// restored from a program binary.
+    explicit GLProgram(GLuint program);
 
     GLProgram(const GLProgram&) = delete;
     GLProgram(GLProgram&&) = delete;
     GLProgram& operator=(const GLProgram&) = delete;
     GLProgram& operator=(GLProgram&&) = delete;
 
-    auto UpdateUniforms() -> void;
+    auto UpdateUniforms() -> size_t;
+
+    /// Checks the compile and link results and reads the active uniforms.
+    /// Without `wait`, returns false while the driver is still compiling,
+    /// which requires GL_KHR_parallel_shader_compile.
+    auto Resolve(bool wait) -> bool;
 
-    auto IsValid() const { return !has_errors_ && program_ > 0; }
+    auto IsPending() const { return pending_; }
+
+    auto IsValid() const { return !pending_ && !has_errors_ && program_ > 0; }
 
     auto Id() const { return program_; }
 
+    /// True when the program reads per-object values from the ub_Object
+    /// block rather than from individual uniforms.
+    auto HasObjectBlock() const { return has_object_block_; }
+
     auto SetUnknownUniform(const std::string& name, const void* v) -> void;
 
     auto SetUniform(Uniform uniform, const void* v) -> void;
@@ -53,10 +71,16 @@ private:
 
     std::array<std::unique_ptr<GLUniform>, uniforms_len> uniforms_ {nullptr};
 
+    std::vector<GLuint> shaders_ {};
+
     GLuint program_ {0};
 
+    bool pending_ {false};
+
     bool has_errors_ {false};
 
+    bool has_object_block_ {false};
+
     auto BindVertexAttributeLocations() const -> void;
 
     auto GetUniformLoc(std::string_view name) const -> int;
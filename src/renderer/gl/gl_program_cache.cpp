@@ -0,0 +1,188 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_program_cache.hpp"
+
+#include "utilities/file.hpp"
+#include "utilities/logger.hpp"
+
+#include <format>
+#include <fstream>
+#include <system_error>
+
+namespace vglx {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr auto kMagic = uint32_t {0x50474C56}; // "VGLP"
+
+constexpr auto kVersion = uint32_t {1};
+
+// Far above any real program binary; larger lengths come from corrupt files.
+constexpr auto kMaxBinaryLength = uint32_t {64} << 20;
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint64_t source_hash;
+    uint64_t driver_hash;
+    uint32_t format;
+    uint32_t length;
+};
+
+// FNV-1a, used instead of std::hash so that hashes are stable across builds.
+auto fnv1a(std::string_view data, uint64_t hash = 0xCBF29CE484222325ull) -> uint64_t {
+    for (const auto c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+auto gl_string(GLenum name) -> std::string_view {
+    const auto value = reinterpret_cast<const char*>(glGetString(name));
+    return value ? value : "";
+}
+
+}
+
+GLProgramCache::GLProgramCache(const fs::path& directory) : directory_(directory) {
+    if (directory_.empty()) return;
+    if (glGetProgramBinary == nullptr || glProgramBinary == nullptr) return;
+
+    auto formats = GLint {0};
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats == 0) {
+        Logger::Log(LogLevel::Warning, "Program binaries are not supported, shader cache disabled");
+        return;
+    }
+
+    auto error = std::error_code {};
+    fs::create_directories(directory_, error);
+    if (error) {
+        Logger::Log(
+            LogLevel::Warning,
+            "Unable to create shader cache directory {}: {}",
+            directory_.string(), error.message()
+        );
+        return;
+    }
+
+    driver_hash_ = fnv1a(gl_string(GL_VENDOR));
+    driver_hash_ = fnv1a(gl_string(GL_RENDERER), driver_hash_);
+    driver_hash_ = fnv1a(gl_string(GL_VERSION), driver_hash_);
+    enabled_ = true;
+}
+
+auto GLProgramCache::Load(std::size_t key, uint64_t source_hash) const -> GLuint {
+    if (!enabled_) return 0;
+
+    const auto path = PathFor(key, source_hash);
+    auto file = std::ifstream {path, std::ios::binary};
+    if (!file) return 0;
+
+    auto header = CacheHeader {};
+    read_binary(file, header);
+    if (!file ||
+        header.magic != kMagic ||
+        header.version != kVersion ||
+        header.key != key ||
+        header.source_hash != source_hash ||
+        header.driver_hash != driver_hash_
+    ) {
+        return 0;
+    }
+
+    // The length comes from disk, so check it before allocating for it
+    auto error = std::error_code {};
+    const auto file_size = fs::file_size(path, error);
+    if (error ||
+        header.length > kMaxBinaryLength ||
+        header.length > file_size - sizeof(CacheHeader)
+    ) {
+        return 0;
+    }
+
+    auto binary = std::vector<char>(header.length);
+    read_binary(file, binary, header.length);
+    if (!file) return 0;
+
+    const auto program = glCreateProgram();
+    glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(header.length));
+
+    // Drivers reject binaries after updates that keep the version string,
+    // in which case the entry is dropped and the program is rebuilt.
+    auto success = GLint {0};
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (success == GL_FALSE) {
+        glDeleteProgram(program);
+        file.close();
+        fs::remove(path, error);
+        return 0;
+    }
+
+    return program;
+}
+
+auto GLProgramCache::Store(std::size_t key, uint64_t source_hash, GLuint program) const -> void {
+    if (!enabled_) return;
+
+    auto length = GLint {0};
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    auto binary = std::vector<char>(static_cast<std::size_t>(length));
+    auto format = GLenum {0};
+    glGetProgramBinary(program, length, &length, &format, binary.data());
+
+    const auto header = CacheHeader {
+        .magic = kMagic,
+        .version = kVersion,
+        .key = key,
+        .source_hash = source_hash,
+        .driver_hash = driver_hash_,
+        .format = format,
+        .length = static_cast<uint32_t>(length)
+    };
+
+    // Written to a temporary file first so that a crash mid-write never
+    // leaves a truncated entry behind.
+    const auto path = PathFor(key, source_hash);
+    auto temp = path;
+    temp += ".tmp";
+    {
+        auto file = std::ofstream {temp, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), length);
+        if (!file) {
+            Logger::Log(LogLevel::Warning, "Unable to write shader cache entry {}", temp.string());
+            return;
+        }
+    }
+
+    auto error = std::error_code {};
+    fs::rename(temp, path, error);
+    if (error) fs::remove(temp, error);
+}
+
+auto GLProgramCache::HashSources(const std::vector<ShaderInfo>& sources) -> uint64_t {
+    auto hash = fnv1a({});
+    for (const auto& shader : sources) {
+        hash = fnv1a(shader.source, hash);
+        hash = fnv1a(std::string_view {"\0", 1}, hash);
+    }
+    return hash;
+}
+
+auto GLProgramCache::PathFor(std::size_t key, uint64_t source_hash) const -> fs::path {
+    return directory_ / std::format("{:016x}-{:016x}.bin", static_cast<uint64_t>(key), source_hash);
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "core/shader_library.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace vglx {
+
+/**
+ * Persists linked shader programs on disk with `glGetProgramBinary`.
+ *
+ * Entries are keyed by the program attributes key and a hash of the final
+ * shader sources, and stamped with a hash of the driver vendor, renderer and
+ * version strings. A binary written by another driver, or one the driver
+ * refuses to load, is treated as a miss and replaced on the next store.
+ *
+ * The cache is disabled when no directory is given or when the context does
+ * not expose any program binary formats.
+ */
+class GLProgramCache {
+public:
+    explicit GLProgramCache(const std::filesystem::path& directory);
+
+    [[nodiscard]] auto Enabled() const { return enabled_; }
+
+    /// Returns a linked program restored from disk, or 0 on a miss.
+    [[nodiscard]] auto Load(std::size_t key, uint64_t source_hash) const -> GLuint;
+
+    auto Store(std::size_t key, uint64_t source_hash, GLuint program) const -> void;
+
+    [[nodiscard]] static auto HashSources(const std::vector<ShaderInfo>& sources) -> uint64_t;
+
+private:
+    std::filesystem::path directory_;
+
+    uint64_t driver_hash_ {0};
+
+    bool enabled_ {false};
+
+    [[nodiscard]] auto PathFor(std::size_t key, uint64_t source_hash) const -> std::filesystem::path;
+};
+
+}
@@ -9,28 +9,100 @@
 
 #include "utilities/logger.hpp"
 
+#include <algorithm>
+#include <string_view>
 #include <vector>
 
 namespace vglx {
 
+namespace {
+
+auto has_parallel_compile() -> bool {
+    auto count = GLint {0};
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (auto i = 0; i < count; ++i) {
+        const auto ext = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (ext == nullptr) continue;
+
+        const auto name = std::string_view {ext};
+        if (name == "GL_KHR_parallel_shader_compile" ||
+            name == "GL_ARB_parallel_shader_compile") {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+GLPrograms::GLPrograms(
+    Renderer::FrameStats* stats,
+    const std::filesystem::path& cache_directory,
+    bool parallel_compile
+) : stats_(stats),
+    cache_(cache_directory),
+    parallel_(parallel_compile && has_parallel_compile()) {}
+
 auto GLPrograms::GetProgram(const ProgramAttributes& attrs) -> GLProgram* {
-    const auto& key = attrs.key;
-    if (!programs_.contains(key)) {
+    auto it = programs_.find(attrs.key);
+    if (it == programs_.end()) {
         auto sources = shader_lib_.GetShaderSource(attrs);
         if (sources.empty()) {
             return nullptr;
         }
 
-        programs_[key] = std::make_unique<GLProgram>(sources);
+        it = programs_.emplace(attrs.key, CreateProgram(attrs, sources)).first;
+    }
+
+    const auto program = it->second.get();
+    if (program->IsPending()) {
+        const auto pending = std::ranges::find(pending_, program, &PendingProgram::program);
+        if (Resolve(*pending)) pending_.erase(pending);
+    }
+    return program;
+}
+
+auto GLPrograms::Poll() -> std::size_t {
+    std::erase_if(pending_, [this](const PendingProgram& pending) {
+        return Resolve(pending);
+    });
+    return pending_.size();
+}
+
+auto GLPrograms::Resolve(const PendingProgram& pending) -> bool {
+    if (!pending.program->Resolve(!parallel_)) return false;
 
+    if (pending.program->IsValid()) {
+        cache_.Store(pending.key, pending.source_hash, pending.program->Id());
+    }
+    return true;
+}
+
+auto GLPrograms::CreateProgram(
+    const ProgramAttributes& attrs,
+    const std::vector<ShaderInfo>& sources
+) -> std::unique_ptr<GLProgram> {
+    const auto source_hash = cache_.Enabled() ? GLProgramCache::HashSources(sources) : 0;
+    if (const auto id = cache_.Load(attrs.key, source_hash)) {
+        ++stats_->program_binary_loads;
         Logger::Log(
             LogLevel::Info,
-            "Created a new shader program {}:{}",
-            key, Material::TypeToString(attrs.type)
+            "Loaded a cached shader program {}:{}",
+            attrs.key, Material::TypeToString(attrs.type)
         );
-
+        return std::make_unique<GLProgram>(id);
     }
-    return programs_[key].get();
+
+    auto program = std::make_unique<GLProgram>(sources, cache_.Enabled());
+    ++stats_->shader_compilations;
+    pending_.emplace_back(PendingProgram {program.get(), attrs.key, source_hash});
+
+    Logger::Log(
+        LogLevel::Info,
+        "Created a new shader program {}:{}",
+        attrs.key, Material::TypeToString(attrs.type)
+    );
+    return program;
 }
 
 }
\ No newline at end of file
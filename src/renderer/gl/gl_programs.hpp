@@ -7,23 +7,65 @@
 
 #pragma once
 
+#include "vglx/core/renderer.hpp"
+
 #include "core/program_attributes.hpp"
 #include "core/shader_library.hpp"
 #include "renderer/gl/gl_program.hpp"
+#include "renderer/gl/gl_program_cache.hpp"
 
+#include <filesystem>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace vglx {
 
+/**
+ * Creates and owns a shader program for every permutation in use.
+ *
+ * With parallel compilation, new programs are returned while still pending
+ * and callers skip them until they are valid; pending programs are polled
+ * whenever they are requested and by @ref Poll. Otherwise programs are
+ * resolved, blocking on the driver, before they are first returned.
+ */
 class GLPrograms {
 public:
+    explicit GLPrograms(
+        Renderer::FrameStats* stats,
+        const std::filesystem::path& cache_directory = {},
+        bool parallel_compile = false
+    );
+
     auto GetProgram(const ProgramAttributes& attrs) -> GLProgram*;
 
+    /// Polls pending programs and returns how many are still compiling.
+    auto Poll() -> std::size_t;
+
+    [[nodiscard]] auto ParallelCompile() const { return parallel_; }
+
 private:
+    struct PendingProgram {
+        GLProgram* program;
+        std::size_t key;
+        uint64_t source_hash;
+    };
+
+    Renderer::FrameStats* stats_;
+
     ShaderLibrary shader_lib_;
 
+    GLProgramCache cache_;
+
     std::unordered_map<std::size_t, std::unique_ptr<GLProgram>> programs_ {};
+
+    std::vector<PendingProgram> pending_ {};
+
+    bool parallel_ {false};
+
+    auto CreateProgram(const ProgramAttributes& attrs, const std::vector<ShaderInfo>& sources) -> std::unique_ptr<GLProgram>;
+
+    auto Resolve(const PendingProgram& pending) -> bool;
 };
 
 }
\ No newline at end of file
@@ -15,18 +15,39 @@
 #include "vglx/nodes/fog.hpp"
 #include "vglx/nodes/instanced_mesh.hpp"
 #include "vglx/nodes/sprite.hpp"
+#include "vglx/utilities/profiler.hpp"
 
 #include "core/program_attributes.hpp"
 #include "core/render_lists.hpp"
 #include "utilities/logger.hpp"
 
+#include <utility>
+#include <vector>
+
 #include <glad/glad.h>
 
 namespace vglx {
 
+namespace {
+
+auto collect_nodes(Node* node, std::vector<Renderable*>& renderables, std::vector<Light*>& lights) -> void {
+    if (node->IsRenderable()) {
+        renderables.emplace_back(static_cast<Renderable*>(node));
+    }
+    if (node->GetNodeType() == Node::Type::Light) {
+        lights.emplace_back(static_cast<Light*>(node));
+    }
+    for (const auto& child : node->Children()) {
+        collect_nodes(child.get(), renderables, lights);
+    }
+}
+
+}
+
 Renderer::Impl::Impl(const Renderer::Parameters& params)
-  : params_(params),
-    render_lists_(std::make_unique<RenderLists>()) {
+  : programs_(&frame_stats_, params.program_cache_directory, params.parallel_shader_compile),
+    params_(params),
+    render_lists_(std::make_unique<RenderLists>(params.incremental_render_lists)) {
     state_.SetViewport(0, 0, params.framebuffer_width, params.framebuffer_height);
     state_.SetClearColor(params.clear_color);
 }
@@ -37,37 +58,64 @@ auto Renderer::Impl::Initialize() -> std::expected<void, std::string> {
 }
 
 auto Renderer::Impl::RenderObjects(Scene* scene, Camera* camera) -> void {
+    VGLX_PROFILE_SCOPE("Renderer::RenderObjects");
     camera_ubo_.Update(camera->projection_matrix, camera->view_matrix);
 
-    for (auto renderable : render_lists_->Opaque()) {
-        RenderObject(renderable, scene, camera);
+    const auto opaque = render_lists_->Opaque();
+    const auto transparent = render_lists_->Transparent();
+
+    // Per-object uniforms for the whole frame go into the ring in one
+    // mapped write; each draw then binds its block by index.
+    const auto lights = LightCounts();
+    const auto write = [&](const RenderItem& item) {
+        const auto& attrs = frame_attrs_.emplace_back(item.renderable, lights, scene);
+        objects_.Write(frame_attrs_.size() - 1, item, attrs);
+    };
+
+    frame_attrs_.clear();
+    objects_.Begin(opaque.size() + transparent.size());
+    for (const auto& item : opaque) write(item);
+    for (const auto& item : transparent) write(item);
+    objects_.End();
+
+    auto index = std::size_t {0};
+    timer_queries_.Begin(GPUPhase::Opaque);
+    for (const auto& item : opaque) {
+        RenderObject(item, index++, scene, camera);
     }
+    timer_queries_.End(GPUPhase::Opaque);
 
-    if (!render_lists_->Transparent().empty()) state_.SetDepthMask(false);
-    for (auto renderable : render_lists_->Transparent()) {
-        RenderObject(renderable, scene, camera);
+    timer_queries_.Begin(GPUPhase::Transparent);
+    if (!transparent.empty()) state_.SetDepthMask(false);
+    for (const auto& item : transparent) {
+        RenderObject(item, index++, scene, camera);
     }
+    timer_queries_.End(GPUPhase::Transparent);
 
     state_.SetDepthMask(true);
-
-    rendered_objects_per_frame_ = rendered_objects_counter_;
-    rendered_objects_counter_ = 0;
 }
 
-auto Renderer::Impl::RenderObject(Renderable* renderable, Scene* scene, Camera* camera) -> void {
+auto Renderer::Impl::RenderObject(
+    const RenderItem& item,
+    std::size_t index,
+    Scene* scene,
+    Camera* camera
+) -> void {
+    auto renderable = item.renderable;
     auto geometry = renderable->GetGeometry().get();
     auto material = renderable->GetMaterial().get();
-    auto attrs = ProgramAttributes {renderable, {
-        .directional = lights_.directional,
-        .point = lights_.point,
-        .spot = lights_.spot
-    }, scene};
+    const auto& attrs = frame_attrs_[index];
 
     auto program = programs_.GetProgram(attrs);
     if (!program->IsValid()) {
+        if (program->IsPending()) ++frame_stats_.pending_objects;
         return;
     }
 
+    // The ring could not be mapped this frame, so the object's block holds
+    // stale data. Programs without the block still get regular uniforms.
+    if (program->HasObjectBlock() && !objects_.IsWritten()) return;
+
     state_.ProcessMaterial(material);
     if (material->wireframe && Renderable::IsMeshType(renderable)) {
         const auto mesh = static_cast<Mesh*>(renderable);
@@ -77,10 +125,11 @@ auto Renderer::Impl::RenderObject(Renderable* renderable, Scene* scene, Camera*
         buffers_.Bind(renderable->GetGeometry());
     }
 
-    SetUniforms(program, &attrs, renderable, camera, scene);
+    SetUniforms(program, &attrs, item, camera, scene);
+    objects_.Bind(index);
 
     state_.UseProgram(program->Id());
-    program->UpdateUniforms();
+    frame_stats_.uniform_uploads += program->UpdateUniforms();
 
     auto primitive = GL_TRIANGLES;
     if (geometry->primitive == GeometryPrimitiveType::Lines) {
@@ -92,6 +141,7 @@ auto Renderer::Impl::RenderObject(Renderable* renderable, Scene* scene, Camera*
 
     const auto index_size = geometry->IndexData().size();
     const auto vertex_size = geometry->VertexCount();
+    auto instances = size_t {1};
 
     if (renderable->GetNodeType() != Node::Type::InstancedMesh) {
         index_size
@@ -107,33 +157,45 @@ auto Renderer::Impl::RenderObject(Renderable* renderable, Scene* scene, Camera*
         index_size
             ? glDrawElementsInstanced(primitive, index_size, GL_UNSIGNED_INT, nullptr, count)
             : glDrawArraysInstanced(primitive, 0, vertex_size, count);
+
+        instances = count;
+        ++frame_stats_.instanced_draws;
+        frame_stats_.instances += count;
     }
 
-    rendered_objects_counter_++;
+    const auto submitted = (index_size ? index_size : vertex_size) * instances;
+    ++frame_stats_.draw_calls;
+    frame_stats_.vertices += submitted;
+    if (primitive == GL_TRIANGLES) {
+        frame_stats_.triangles += submitted / 3;
+    }
 }
 
 auto Renderer::Impl::SetUniforms(
     GLProgram* program,
-    ProgramAttributes* attrs,
-    Renderable* renderable,
+    const ProgramAttributes* attrs,
+    const RenderItem& item,
     Camera* camera,
     Scene* scene
 ) -> void {
+    auto renderable = item.renderable;
     auto material = renderable->GetMaterial().get();
-    auto model = renderable->GetWorldTransform();
     auto resolution = Vector2(
         params_.framebuffer_width,
         params_.framebuffer_height
     );
 
-    program->SetUniform(Uniform::Model, &model);
-    program->SetUniform(Uniform::Opacity, &material->opacity);
     program->SetUniform(Uniform::Resolution, &resolution);
 
+    // Model, material and texture transform values live in ub_Object, see
+    // GLObjects. Programs without the block, such as shader materials that
+    // declare their own u_Model, still receive them as regular uniforms.
+    if (!program->HasObjectBlock()) {
+        SetObjectUniforms(program, attrs, item);
+    }
+
     const auto bind_texture = [&](GLTextureMapType type, std::shared_ptr<Texture2D> tex) {
         textures_.Bind(tex, type);
-        const auto& transform = tex->GetTransform();
-        program->SetUniform(Uniform::TextureTransform, &transform);
         switch(type) {
             case GLTextureMapType::AlbedoMap:
                 program->SetUniform(Uniform::AlbedoMap, &type);
@@ -174,11 +236,10 @@ auto Renderer::Impl::SetUniforms(
 
     if (attrs->type == Material::Type::PhongMaterial) {
         auto m = static_cast<PhongMaterial*>(material);
-        if (lights_.HasLights()) {
+        // A dynamic light program is shared across light counts, so it has
+        // to be refreshed even when the scene no longer has lights.
+        if (lights_.HasLights() || attrs->dynamic_lights) {
             program->SetUniform(Uniform::AmbientLight, &lights_.ambient_light);
-            program->SetUniform(Uniform::MaterialDiffuseColor, &m->color);
-            program->SetUniform(Uniform::MaterialSpecularColor, &m->specular);
-            program->SetUniform(Uniform::MaterialShininess, &m->shininess);
         }
 
         if (attrs->albedo_map)
@@ -200,20 +261,12 @@ auto Renderer::Impl::SetUniforms(
 
     if (attrs->type == Material::Type::SpriteMaterial) {
         auto m = static_cast<SpriteMaterial*>(material);
-        auto r = static_cast<Sprite*>(renderable);
-
-        program->SetUniform(Uniform::Anchor, &r->anchor);
-        program->SetUniform(Uniform::Color, &m->color);
-        program->SetUniform(Uniform::Rotation, &r->rotation);
-
         if (attrs->texture_map)
             bind_texture(GLTextureMapType::TextureMap, m->texture_map);
     }
 
     if (attrs->type == Material::Type::UnlitMaterial) {
         auto m = static_cast<UnlitMaterial*>(material);
-        program->SetUniform(Uniform::Color, &m->color);
-
         if (attrs->texture_map)
             bind_texture(GLTextureMapType::TextureMap, m->texture_map);
         if (attrs->alpha_map)
@@ -221,26 +274,113 @@ auto Renderer::Impl::SetUniforms(
     }
 }
 
+auto Renderer::Impl::SetObjectUniforms(
+    GLProgram* program,
+    const ProgramAttributes* attrs,
+    const RenderItem& item
+) -> void {
+    auto renderable = item.renderable;
+    auto material = renderable->GetMaterial().get();
+
+    program->SetUniform(Uniform::Model, &item.world_transform);
+    program->SetUniform(Uniform::Opacity, &material->opacity);
+
+    if (auto map = GLObjects::TextureTransformMap(material, *attrs)) {
+        const auto& transform = map->GetTransform();
+        program->SetUniform(Uniform::TextureTransform, &transform);
+    }
+
+    if (attrs->type == Material::Type::PhongMaterial) {
+        auto m = static_cast<PhongMaterial*>(material);
+        program->SetUniform(Uniform::MaterialDiffuseColor, &m->color);
+        program->SetUniform(Uniform::MaterialSpecularColor, &m->specular);
+        program->SetUniform(Uniform::MaterialShininess, &m->shininess);
+    }
+
+    if (attrs->type == Material::Type::SpriteMaterial) {
+        auto m = static_cast<SpriteMaterial*>(material);
+        auto r = static_cast<Sprite*>(renderable);
+        program->SetUniform(Uniform::Anchor, &r->anchor);
+        program->SetUniform(Uniform::Color, &m->color);
+        program->SetUniform(Uniform::Rotation, &r->rotation);
+    }
+
+    if (attrs->type == Material::Type::UnlitMaterial) {
+        auto m = static_cast<UnlitMaterial*>(material);
+        program->SetUniform(Uniform::Color, &m->color);
+    }
+}
+
 auto Renderer::Impl::ProcessLights(Camera* camera) -> void {
+    VGLX_PROFILE_SCOPE("Renderer::ProcessLights");
     lights_.Reset();
 
     for(auto light : render_lists_->Lights()) {
         lights_.AddLight(light, camera);
     }
 
-    if (lights_.HasLights()) lights_.Update();
+    if (lights_.HasLights() || params_.dynamic_light_count) lights_.Update();
+}
+
+auto Renderer::Impl::LightCounts() const -> ProgramAttributes::LightsCounter {
+    return {
+        .directional = lights_.directional,
+        .point = lights_.point,
+        .spot = lights_.spot,
+        .dynamic = params_.dynamic_light_count,
+        .capacity = GLLights::kMaxLights
+    };
 }
 
 auto Renderer::Impl::Render(Scene* scene, Camera* camera) -> void {
+    VGLX_PROFILE_SCOPE("Renderer::Render");
+
+    timer_queries_.BeginFrame();
+    const auto gpu_timer = GLTimerScope {&timer_queries_, GPUPhase::Frame};
+
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    scene->UpdateTransformHierarchy();
-    camera->UpdateViewMatrix();
+    {
+        VGLX_PROFILE_SCOPE("Scene::UpdateTransformHierarchy");
+        scene->UpdateTransformHierarchy();
+        camera->UpdateViewMatrix();
+    }
 
     render_lists_->ProcessScene(scene, camera);
+    frame_stats_.visible_objects = render_lists_->Opaque().size() + render_lists_->Transparent().size();
+    frame_stats_.culled_objects = render_lists_->Culled();
     ProcessLights(camera);
 
     RenderObjects(scene, camera);
+
+    last_frame_stats_ = std::exchange(frame_stats_, {});
+}
+
+auto Renderer::Impl::Compile(Scene* scene, Camera* camera) -> void {
+    VGLX_PROFILE_SCOPE("Renderer::Compile");
+
+    scene->UpdateTransformHierarchy();
+    camera->UpdateViewMatrix();
+
+    auto renderables = std::vector<Renderable*> {};
+    auto lights = std::vector<Light*> {};
+    collect_nodes(scene, renderables, lights);
+
+    // Light counts are part of the program key unless the renderer uses
+    // dynamic light counts, so they are gathered the same way a frame
+    // gathers them. Render resets them again.
+    lights_.Reset();
+    for (auto light : lights) {
+        lights_.AddLight(light, camera);
+    }
+
+    for (auto renderable : renderables) {
+        const auto material = renderable->GetMaterial();
+        if (material && !material->visible) continue;
+        if (!Renderable::CanRender(renderable)) continue;
+
+        programs_.GetProgram(ProgramAttributes {renderable, LightCounts(), scene});
+    }
 }
 
 auto Renderer::Impl::SetViewport(int x, int y, int width, int height) -> void {
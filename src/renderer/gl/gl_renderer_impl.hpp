@@ -13,15 +13,19 @@
 #include "renderer/gl/gl_buffers.hpp"
 #include "renderer/gl/gl_camera.hpp"
 #include "renderer/gl/gl_lights.hpp"
+#include "renderer/gl/gl_objects.hpp"
 #include "renderer/gl/gl_programs.hpp"
 #include "renderer/gl/gl_state.hpp"
 #include "renderer/gl/gl_textures.hpp"
+#include "renderer/gl/gl_timer_queries.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace vglx {
 
 class RenderLists;
+struct RenderItem;
 
 class Renderer::Impl {
 public:
@@ -36,44 +40,88 @@ public:
 
     auto Render(Scene* scene, Camera* camera) -> void;
 
+    auto Compile(Scene* scene, Camera* camera) -> void;
+
+    [[nodiscard]] auto PendingPrograms() -> size_t {
+        return programs_.Poll();
+    }
+
     auto SetViewport(int x, int y, int width, int height) -> void;
 
     auto SetClearColor(const Color& color) -> void;
 
     [[nodiscard]] auto RenderedObjectsPerFrame() const {
-        return rendered_objects_per_frame_;
+        return last_frame_stats_.draw_calls;
+    }
+
+    [[nodiscard]] auto GetFrameStats() const -> const Renderer::FrameStats& {
+        return last_frame_stats_;
+    }
+
+    [[nodiscard]] auto GetGPUTimings() const -> const Renderer::GPUTimings& {
+        return timer_queries_.Timings();
+    }
+
+    auto BeginUIPass() -> void {
+        timer_queries_.Begin(GPUPhase::UI);
+    }
+
+    auto EndUIPass() -> void {
+        timer_queries_.End(GPUPhase::UI);
     }
 
     ~Impl();
 
 private:
-    GLBuffers buffers_;
+    // Declared first so they outlive the members that record into them.
+    // Counters accumulate from the end of one frame to the end of the next,
+    // so work done between frames, such as Compile, lands in the next frame.
+    Renderer::FrameStats frame_stats_;
+    Renderer::FrameStats last_frame_stats_;
+    GLTimerQueries timer_queries_;
+
+    GLBuffers buffers_ {&timer_queries_, &frame_stats_};
     GLCamera camera_ubo_;
     GLLights lights_;
-    GLPrograms programs_;
-    GLState state_;
-    GLTextures textures_;
+    GLObjects objects_ {&frame_stats_};
+    GLPrograms programs_ {&frame_stats_};
+    GLState state_ {&frame_stats_};
+    GLTextures textures_ {&timer_queries_, &frame_stats_};
 
     Renderer::Parameters params_;
 
     std::unique_ptr<RenderLists> render_lists_;
 
-    size_t rendered_objects_counter_ {0};
-    size_t rendered_objects_per_frame_ {0};
+    // Attributes of every item in the frame's render lists, in draw order.
+    // Reused across frames so steady-state frames do not allocate.
+    std::vector<ProgramAttributes> frame_attrs_;
 
     auto ProcessLights(Camera* camera) -> void;
 
+    [[nodiscard]] auto LightCounts() const -> ProgramAttributes::LightsCounter;
+
     auto RenderObjects(Scene* scene, Camera* camera) -> void;
 
-    auto RenderObject(Renderable* renderable, Scene* scene, Camera* camera) -> void;
+    auto RenderObject(
+        const RenderItem& item,
+        std::size_t index,
+        Scene* scene,
+        Camera* camera
+    ) -> void;
 
     auto SetUniforms(
         GLProgram* program,
-        ProgramAttributes* attrs,
-        Renderable* renderable,
+        const ProgramAttributes* attrs,
+        const RenderItem& item,
         Camera* camera,
         Scene* scene
     ) -> void;
+
+    auto SetObjectUniforms(
+        GLProgram* program,
+        const ProgramAttributes* attrs,
+        const RenderItem& item
+    ) -> void;
 };
 
 }
\ No newline at end of file
@@ -55,6 +55,7 @@ auto GLState::UseProgram(unsigned int program_id) -> void {
     if (curr_program_ != program_id) {
         glUseProgram(program_id);
         curr_program_ = program_id;
+        ++stats_->program_binds;
     }
 }
 
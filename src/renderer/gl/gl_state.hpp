@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <vglx/core/renderer.hpp>
 #include <vglx/materials/material.hpp>
 #include <vglx/math/color.hpp>
 
@@ -17,6 +18,8 @@ namespace vglx {
 
 class GLState {
 public:
+    explicit GLState(Renderer::FrameStats* stats) : stats_(stats) {}
+
     auto ProcessMaterial(const Material* material) -> void;
 
     auto SetClearColor(const Color& color) -> void;
@@ -30,6 +33,8 @@ public:
     auto Reset() -> void;
 
 private:
+    Renderer::FrameStats* stats_;
+
     std::unordered_map<int, bool> features_;
 
     Material::Blending curr_blending_ {Material::Blending::None};
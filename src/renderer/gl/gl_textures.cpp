@@ -8,7 +8,9 @@
 #include "renderer/gl/gl_textures.hpp"
 
 #include "vglx/textures/texture_2d.hpp"
+#include "vglx/utilities/profiler.hpp"
 
+#include "renderer/gl/gl_timer_queries.hpp"
 #include "utilities/logger.hpp"
 
 #include <utility>
@@ -32,9 +34,13 @@ auto GLTextures::Bind(
 
     glBindTexture(GL_TEXTURE_2D, tex_id);
     current_texture_ids_[tex_unit] = tex_id;
+    ++stats_->texture_binds;
 }
 
 auto GLTextures::GenerateTexture(Texture* texture) const -> GLuint {
+    VGLX_PROFILE_SCOPE("GLTextures::Upload");
+    const auto gpu_timer = GLTimerScope {timer_queries_, GPUPhase::Uploads};
+
     auto& tex_id = texture->renderer_id;
     glGenTextures(1, &tex_id);
     glBindTexture(GL_TEXTURE_2D, tex_id);
@@ -58,6 +64,7 @@ auto GLTextures::GenerateTexture(Texture* texture) const -> GLuint {
         GL_UNSIGNED_BYTE,
         texture_2d->data.data()
     );
+    stats_->texture_upload_bytes += texture_2d->data.size();
 
     // Complete without mipmaps
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
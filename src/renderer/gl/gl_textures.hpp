@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "vglx/core/renderer.hpp"
 #include "vglx/textures/texture.hpp"
 
 #include <array>
@@ -19,6 +20,8 @@
 
 namespace vglx {
 
+class GLTimerQueries;
+
 enum class GLTextureMapType {
     AlbedoMap = 0,
     AlphaMap = 1,
@@ -29,7 +32,9 @@ enum class GLTextureMapType {
 
 class GLTextures {
 public:
-    GLTextures() = default;
+    GLTextures(GLTimerQueries* timer_queries, Renderer::FrameStats* stats) :
+        timer_queries_(timer_queries),
+        stats_(stats) {}
 
     GLTextures(const GLTextures&) = delete;
     GLTextures(GLTextures&&) = delete;
@@ -44,6 +49,10 @@ public:
     ~GLTextures();
 
 private:
+    GLTimerQueries* timer_queries_;
+
+    Renderer::FrameStats* stats_;
+
     std::vector<std::weak_ptr<Texture>> textures_;
 
     std::array<GLuint, 16> current_texture_ids_ {};
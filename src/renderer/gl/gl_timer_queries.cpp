@@ -0,0 +1,114 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_timer_queries.hpp"
+
+#include <algorithm>
+
+namespace vglx {
+
+GLTimerQueries::GLTimerQueries() {
+    // Timer queries are core since OpenGL 3.3, but the loader leaves the
+    // entry points null when the driver does not expose them.
+    supported_ = glQueryCounter != nullptr && glGetQueryObjectui64v != nullptr;
+    if (!supported_) return;
+
+    for (auto& frame : frames_) {
+        glGenQueries(static_cast<GLsizei>(frame.ids.size()), frame.ids.data());
+    }
+    open_.fill(kNone);
+}
+
+auto GLTimerQueries::BeginFrame() -> void {
+    if (!supported_) return;
+
+    current_ = (current_ + 1) % kFramesInFlight;
+    auto& frame = frames_[current_];
+    Collect(frame);
+    frame.count = 0;
+    frame.dropped = 0;
+    open_.fill(kNone);
+    begun_.fill(false);
+    reserved_ = kFixedPhases;
+}
+
+auto GLTimerQueries::Begin(GPUPhase phase) -> void {
+    if (!supported_) return;
+
+    auto& frame = frames_[current_];
+    auto& begun = begun_[std::to_underlying(phase)];
+    if (phase != GPUPhase::Uploads && !begun) {
+        // Takes the slot held back for this phase
+        begun = true;
+        --reserved_;
+    } else if (frame.count + reserved_ == kMaxIntervals) {
+        ++frame.dropped;
+        return;
+    }
+
+    const auto i = frame.count++;
+    frame.phases[i] = phase;
+    frame.closed[i] = false;
+    open_[std::to_underlying(phase)] = i;
+    glQueryCounter(frame.ids[i * 2], GL_TIMESTAMP);
+}
+
+auto GLTimerQueries::End(GPUPhase phase) -> void {
+    if (!supported_) return;
+
+    auto& open = open_[std::to_underlying(phase)];
+    if (open == kNone) return;
+
+    auto& frame = frames_[current_];
+    glQueryCounter(frame.ids[open * 2 + 1], GL_TIMESTAMP);
+    frame.closed[open] = true;
+    open = kNone;
+}
+
+auto GLTimerQueries::Collect(FrameQueries& frame) -> void {
+    if (frame.count == 0) return;
+
+    for (auto i = std::size_t {0}; i < frame.count; ++i) {
+        if (!frame.closed[i]) continue;
+        auto available = GLint {GL_FALSE};
+        glGetQueryObjectiv(frame.ids[i * 2 + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        // Results are still in flight, skip the frame rather than wait
+        if (available == GL_FALSE) return;
+    }
+
+    auto elapsed = std::array<GLuint64, kPhases> {};
+    for (auto i = std::size_t {0}; i < frame.count; ++i) {
+        if (!frame.closed[i]) continue;
+        auto start = GLuint64 {0};
+        auto end = GLuint64 {0};
+        glGetQueryObjectui64v(frame.ids[i * 2], GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(frame.ids[i * 2 + 1], GL_QUERY_RESULT, &end);
+        elapsed[std::to_underlying(frame.phases[i])] += end - std::min(start, end);
+    }
+
+    const auto to_ms = [&](GPUPhase phase) {
+        return static_cast<double>(elapsed[std::to_underlying(phase)]) / 1e6;
+    };
+
+    timings_.opaque = to_ms(GPUPhase::Opaque);
+    timings_.transparent = to_ms(GPUPhase::Transparent);
+    timings_.uploads = to_ms(GPUPhase::Uploads);
+    timings_.ui = to_ms(GPUPhase::UI);
+    timings_.total = to_ms(GPUPhase::Frame) + timings_.ui;
+    timings_.dropped_intervals = frame.dropped;
+    timings_.available = true;
+}
+
+GLTimerQueries::~GLTimerQueries() {
+    if (!supported_) return;
+
+    for (auto& frame : frames_) {
+        glDeleteQueries(static_cast<GLsizei>(frame.ids.size()), frame.ids.data());
+    }
+}
+
+}
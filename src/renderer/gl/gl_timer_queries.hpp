@@ -0,0 +1,116 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include "vglx/core/renderer.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <glad/glad.h>
+
+namespace vglx {
+
+enum class GPUPhase : uint8_t {
+    Frame,
+    Opaque,
+    Transparent,
+    Uploads,
+    UI,
+    Count
+};
+
+/**
+ * Measures GPU time per render phase with GL_TIMESTAMP queries.
+ *
+ * Timestamps are used instead of GL_TIME_ELAPSED because elapsed-time queries
+ * cannot nest, and uploads happen inside the opaque and transparent passes.
+ * Queries are kept for several frames in flight and a frame's results are only
+ * read once the driver reports them available, so collecting them never
+ * stalls the pipeline. Frames whose results are not ready in time are skipped.
+ *
+ * Every phase except uploads is timed once per frame, and a query slot is held
+ * back for each of them until it begins, so a frame with many uploads cannot
+ * leave the later passes unmeasured. Upload intervals that do not fit are
+ * dropped and counted in the timings.
+ */
+class GLTimerQueries {
+public:
+    GLTimerQueries();
+
+    GLTimerQueries(const GLTimerQueries&) = delete;
+    GLTimerQueries(GLTimerQueries&&) = delete;
+    GLTimerQueries& operator=(const GLTimerQueries&) = delete;
+    GLTimerQueries& operator=(GLTimerQueries&&) = delete;
+
+    auto BeginFrame() -> void;
+
+    auto Begin(GPUPhase phase) -> void;
+
+    auto End(GPUPhase phase) -> void;
+
+    [[nodiscard]] auto Timings() const -> const Renderer::GPUTimings& {
+        return timings_;
+    }
+
+    ~GLTimerQueries();
+
+private:
+    static constexpr auto kFramesInFlight = std::size_t {3};
+    static constexpr auto kMaxIntervals = std::size_t {64};
+    static constexpr auto kNone = static_cast<std::size_t>(-1);
+    static constexpr auto kPhases = std::to_underlying(GPUPhase::Count);
+    static constexpr auto kFixedPhases = std::size_t {kPhases - 1};
+
+    struct FrameQueries {
+        std::array<GLuint, kMaxIntervals * 2> ids {};
+        std::array<GPUPhase, kMaxIntervals> phases {};
+        std::array<bool, kMaxIntervals> closed {};
+        std::size_t count {0};
+        std::size_t dropped {0};
+    };
+
+    std::array<FrameQueries, kFramesInFlight> frames_ {};
+
+    std::array<std::size_t, kPhases> open_ {};
+
+    std::array<bool, kPhases> begun_ {};
+
+    std::size_t reserved_ {kFixedPhases};
+
+    Renderer::GPUTimings timings_ {};
+
+    std::size_t current_ {0};
+
+    bool supported_ {false};
+
+    auto Collect(FrameQueries& frame) -> void;
+};
+
+/// Records a GPU phase for the lifetime of the scope.
+class GLTimerScope {
+public:
+    GLTimerScope(GLTimerQueries* queries, GPUPhase phase) : queries_(queries), phase_(phase) {
+        if (queries_) queries_->Begin(phase_);
+    }
+
+    GLTimerScope(const GLTimerScope&) = delete;
+    GLTimerScope& operator=(const GLTimerScope&) = delete;
+
+    ~GLTimerScope() {
+        if (queries_) queries_->End(phase_);
+    }
+
+private:
+    GLTimerQueries* queries_;
+    GPUPhase phase_;
+};
+
+}
@@ -89,7 +89,7 @@ public:
 
     auto SetValue(const void* value) -> void;
 
-    auto UploadIfNeeded() -> void;
+    auto UploadIfNeeded() -> bool;
 
 private:
     std::string name_;
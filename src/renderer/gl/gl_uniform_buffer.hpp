@@ -19,6 +19,7 @@ namespace vglx {
 enum class UniformBuffer {
     Camera,
     Lights,
+    Object,
     KnownUniformBuffersLength
 };
 
@@ -26,6 +27,7 @@ constexpr auto get_uniform_block_loc(std::string_view str) {
     using enum UniformBuffer;
     if (str == "ub_Camera") return static_cast<int>(Camera);
     if (str == "ub_Lights") return static_cast<int>(Lights);
+    if (str == "ub_Object") return static_cast<int>(Object);
     return -1;
 }
 
@@ -0,0 +1,114 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "renderer/gl/gl_uniform_ring.hpp"
+
+#include "renderer/gl/gl_uniform_buffer.hpp"
+
+#include "utilities/logger.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace vglx {
+
+GLUniformRing::GLUniformRing(std::string_view name, std::size_t block_size, std::size_t capacity) :
+    name_(name),
+    binding_point_(get_uniform_block_loc(name)),
+    block_size_(block_size)
+{
+    if (binding_point_ == -1) {
+        Logger::Log(LogLevel::Error, "Unknown uniform block {}", name);
+        return;
+    }
+
+    // Ranges bound with glBindBufferRange must start on this alignment
+    auto alignment = GLint {0};
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    const auto align = static_cast<std::size_t>(std::max(alignment, GLint {16}));
+    stride_ = (block_size_ + align - 1) / align * align;
+    capacity_ = std::max(capacity, stride_);
+
+    glGenBuffers(1, &buffer_);
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer_);
+    glBufferData(GL_UNIFORM_BUFFER, capacity_, nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+auto GLUniformRing::Map(std::size_t count) -> std::byte* {
+    if (binding_point_ == -1 || count == 0) return nullptr;
+
+    const auto size = count * stride_;
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer_);
+
+    if (size > capacity_) {
+        capacity_ = std::max(capacity_ * 2, std::bit_ceil(size));
+        glBufferData(GL_UNIFORM_BUFFER, capacity_, nullptr, GL_STREAM_DRAW);
+        head_ = 0;
+    } else if (head_ + size > capacity_) {
+        // Orphan the storage so the driver can keep the old one alive for
+        // draws in flight while the ring starts over
+        glBufferData(GL_UNIFORM_BUFFER, capacity_, nullptr, GL_STREAM_DRAW);
+        head_ = 0;
+    }
+
+    auto mapped = glMapBufferRange(
+        GL_UNIFORM_BUFFER,
+        static_cast<GLintptr>(head_),
+        static_cast<GLsizeiptr>(size),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT
+    );
+
+    if (!mapped) {
+        // Report once rather than every frame until a map succeeds again
+        if (!map_failed_) {
+            Logger::Log(LogLevel::Error, "Unable to map uniform ring {}", name_);
+        }
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        map_failed_ = true;
+        return nullptr;
+    }
+
+    base_ = head_;
+    head_ += size;
+    mapped_ = true;
+    bound_ = false;
+    map_failed_ = false;
+    return static_cast<std::byte*>(mapped);
+}
+
+auto GLUniformRing::Unmap() -> void {
+    if (!mapped_) return;
+    glUnmapBuffer(GL_UNIFORM_BUFFER);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    mapped_ = false;
+}
+
+auto GLUniformRing::Bind(std::size_t index) -> void {
+    if (binding_point_ == -1) return;
+
+    const auto offset = base_ + index * stride_;
+    if (bound_ && offset == bound_offset_) return;
+
+    glBindBufferRange(
+        GL_UNIFORM_BUFFER,
+        binding_point_,
+        buffer_,
+        static_cast<GLintptr>(offset),
+        static_cast<GLsizeiptr>(block_size_)
+    );
+    bound_offset_ = offset;
+    bound_ = true;
+}
+
+GLUniformRing::~GLUniformRing() {
+    if (buffer_ != 0) {
+        glDeleteBuffers(1, &buffer_);
+    }
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <glad/glad.h>
+
+namespace vglx {
+
+/**
+ * Uniform buffer that holds one block per draw, bound with glBindBufferRange.
+ *
+ * Each frame maps a fresh range at the head of the ring, writes every block
+ * for the frame into it and unmaps it before the first draw. Ranges are never
+ * rewritten until the ring wraps, at which point the buffer is orphaned, so
+ * the map is unsynchronized and never waits on draws still in flight.
+ */
+class GLUniformRing {
+public:
+    static constexpr auto kDefaultCapacity = std::size_t {1} << 20;
+
+    GLUniformRing(std::string_view name, std::size_t block_size, std::size_t capacity = kDefaultCapacity);
+
+    // delete copy constructor and assignment operator
+    GLUniformRing(const GLUniformRing&) = delete;
+    auto operator=(const GLUniformRing&) -> GLUniformRing& = delete;
+
+    // delete move constructor and assignment operator
+    GLUniformRing(GLUniformRing&&) = delete;
+    auto operator=(GLUniformRing&&) -> GLUniformRing& = delete;
+
+    /// Maps space for `count` blocks, `Stride()` bytes apart. Returns null
+    /// when there is nothing to map or the buffer could not be mapped, in
+    /// which case nothing from the range may be bound.
+    [[nodiscard]] auto Map(std::size_t count) -> std::byte*;
+
+    auto Unmap() -> void;
+
+    /// Binds block `index` of the last mapped range.
+    auto Bind(std::size_t index) -> void;
+
+    [[nodiscard]] auto Stride() const { return stride_; }
+
+    [[nodiscard]] auto Capacity() const { return capacity_; }
+
+    ~GLUniformRing();
+
+private:
+    std::string name_ {""};
+    GLuint buffer_ {0};
+    int binding_point_ {-1};
+    std::size_t block_size_ {0};
+    std::size_t stride_ {0};
+    std::size_t capacity_ {0};
+    std::size_t head_ {0};
+    std::size_t base_ {0};
+    std::size_t bound_offset_ {0};
+    bool mapped_ {false};
+    bool bound_ {false};
+    bool map_failed_ {false};
+};
+
+}
@@ -9,13 +9,6 @@ precision mediump float;
 #include "snippets/frag_global_params.glsl"
 #include "snippets/frag_global_fog.glsl"
 
-struct PhongMaterial {
-    vec3 DiffuseColor;
-    vec3 SpecularColor;
-    float Shininess;
-};
-
-uniform PhongMaterial u_Material;
 uniform vec3 u_AmbientLight;
 
 vec3 phongShading(
@@ -33,8 +26,8 @@ vec3 phongShading(
     vec3 specular = vec3(0.0);
     if (diffuse_factor > 0.0) {
         vec3 halfway = normalize(light_dir + v_ViewDir);
-        specular = light_color * (u_Material.SpecularColor * specular_factor) *
-                   pow(max(dot(halfway, normal), 0.0), max(u_Material.Shininess, 1.0));
+        specular = light_color * (u_SpecularColor * specular_factor) *
+                   pow(max(dot(halfway, normal), 0.0), max(u_Shininess, 1.0));
     }
 
     return diffuse + specular;
@@ -56,6 +49,10 @@ struct Light {
 
 layout(std140) uniform ub_Lights {
     Light u_Lights[NUM_LIGHTS];
+    #ifdef USE_DYNAMIC_LIGHTS
+        // NUM_LIGHTS is the array capacity, this is the number of active lights
+        int u_NumLights;
+    #endif
 };
 
 float attenuation(in float dist, in Light light) {
@@ -72,6 +69,10 @@ vec3 processLights(
 ) {
     vec3 output_color = vec3(0.0);
     for (int i = 0; i < NUM_LIGHTS; i++) {
+        #ifdef USE_DYNAMIC_LIGHTS
+            if (i >= u_NumLights) break;
+        #endif
+
         Light light = u_Lights[i];
 
         if (light.Type == 1 /* directional light */) {
@@ -120,7 +121,7 @@ vec3 processLights(
 void main() {
     #include "snippets/frag_main_normal.glsl"
 
-    vec3 diffuse_color = u_Material.DiffuseColor;
+    vec3 diffuse_color = u_Color;
     float opacity = u_Opacity;
 
     #ifdef USE_INSTANCING
@@ -8,8 +8,15 @@ output color, varyings, and uniforms accessible within the fragment shader.
 @varying vec3 v_Normal - Normal vector (see frag_main_normal.glsl)
 @varying vec3 v_ViewDir - View direction vector
 @varying vec4 v_Position - Fragment position in view space
-@uniform vec3 u_Color - Base color of the fragment
-@uniform float u_Opacity - Fragment opacity
+@uniform ub_Object - Per-object block, declared identically in vert_global_params.glsl:
+    mat4 u_Model - Model transformation matrix
+    mat3 u_TextureTransform - Applies texture coordinate transformations
+    vec3 u_Color - Base color of the material
+    float u_Opacity - Material opacity
+    vec3 u_SpecularColor - Specular color (phong material)
+    float u_Shininess - Specular exponent (phong material)
+    vec2 u_Anchor - Sprite anchor point (sprite material)
+    float u_Rotation - Sprite rotation in radians (sprite material)
 @uniform sampler2D u_AlbedoMap - Albedo texture map
 @uniform sampler2D u_AlphaMap - Opacity texture map
 @uniform sampler2D u_NormalMap - Normals texture map
@@ -38,8 +45,17 @@ in vec3 v_Normal;
 in vec3 v_ViewDir;
 in vec4 v_Position;
 
-uniform float u_Opacity;
-uniform vec3 u_Color;
+layout(std140) uniform ub_Object {
+    mat4 u_Model;
+    mat3 u_TextureTransform;
+    vec3 u_Color;
+    float u_Opacity;
+    vec3 u_SpecularColor;
+    float u_Shininess;
+    vec2 u_Anchor;
+    float u_Rotation;
+};
+
 uniform sampler2D u_AlbedoMap;
 uniform sampler2D u_AlphaMap;
 uniform sampler2D u_NormalMap;
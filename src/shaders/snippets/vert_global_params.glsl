@@ -7,8 +7,15 @@ used in both the vertex and fragment shaders.
 @in vec3 a_Normal - Vertex normal
 @in vec2 a_TexCoord - Vertex texture coordinate
 @in mat4 a_InstanceTransform - Instance transformation matrix
-@uniform mat3 u_TextureTransform - Applies texture coordinate transformations
-@uniform mat4 u_Model - Model transformation matrix
+@uniform ub_Object - Per-object block, declared identically in frag_global_params.glsl:
+    mat4 u_Model - Model transformation matrix
+    mat3 u_TextureTransform - Applies texture coordinate transformations
+    vec3 u_Color - Base color of the material
+    float u_Opacity - Material opacity
+    vec3 u_SpecularColor - Specular color (phong material)
+    float u_Shininess - Specular exponent (phong material)
+    vec2 u_Anchor - Sprite anchor point (sprite material)
+    float u_Rotation - Sprite rotation in radians (sprite material)
 @uniform mat4 u_Projection - Projection transformation matrix
 @uniform mat4 u_View - View transformation matrix
 @out float v_ViewDepth - Depth of the vertex in view space
@@ -39,8 +46,16 @@ in vec2 a_TexCoord;
     out mat3 v_TBN;
 #endif
 
-uniform mat3 u_TextureTransform;
-uniform mat4 u_Model;
+layout(std140) uniform ub_Object {
+    mat4 u_Model;
+    mat3 u_TextureTransform;
+    vec3 u_Color;
+    float u_Opacity;
+    vec3 u_SpecularColor;
+    float u_Shininess;
+    vec2 u_Anchor;
+    float u_Rotation;
+};
 
 out float v_ViewDepth;
 out vec2 v_TexCoord;
@@ -7,9 +7,6 @@
 #include "snippets/vert_global_params.glsl"
 #include "snippets/utilities.glsl"
 
-uniform float u_Rotation;
-uniform vec2 u_Anchor;
-
 void main() {
     #include "snippets/vert_main_varyings.glsl"
 
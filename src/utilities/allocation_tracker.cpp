@@ -0,0 +1,174 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/utilities/allocation_tracker.hpp"
+
+#ifdef VGLX_TRACK_ALLOCATIONS
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace vglx {
+
+namespace {
+
+// Plain integers are used so that reading them never allocates and they need
+// no dynamic initialization before the first allocation on a thread.
+thread_local std::size_t thread_allocations = 0;
+thread_local std::size_t thread_allocated_bytes = 0;
+
+}
+
+auto AllocationTracker::IsEnabled() -> bool {
+#ifdef VGLX_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+auto AllocationTracker::ThreadAllocations() -> std::size_t {
+    return thread_allocations;
+}
+
+auto AllocationTracker::ThreadAllocatedBytes() -> std::size_t {
+    return thread_allocated_bytes;
+}
+
+}
+
+#ifdef VGLX_TRACK_ALLOCATIONS
+
+namespace {
+
+auto tracked_alloc(std::size_t size, std::size_t alignment) noexcept -> void* {
+    ++vglx::thread_allocations;
+    vglx::thread_allocated_bytes += size;
+    if (size == 0) size = 1;
+
+    while (true) {
+        void* ptr = nullptr;
+        if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ptr = std::malloc(size);
+        } else {
+#ifdef _MSC_VER
+            ptr = _aligned_malloc(size, alignment);
+#else
+            // aligned_alloc requires the size to be a multiple of the alignment
+            ptr = std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+        }
+        if (ptr) return ptr;
+
+        // The library is built without exceptions, so an exhausted allocator
+        // without a new handler cannot report std::bad_alloc.
+        const auto handler = std::get_new_handler();
+        if (!handler) return nullptr;
+        handler();
+    }
+}
+
+auto tracked_free(void* ptr, std::size_t alignment) noexcept -> void {
+#ifdef _MSC_VER
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        _aligned_free(ptr);
+        return;
+    }
+#else
+    static_cast<void>(alignment);
+#endif
+    std::free(ptr);
+}
+
+auto checked(void* ptr) -> void* {
+    if (!ptr) std::abort();
+    return ptr;
+}
+
+}
+
+auto operator new(std::size_t size) -> void* {
+    return checked(tracked_alloc(size, 0));
+}
+
+auto operator new[](std::size_t size) -> void* {
+    return checked(tracked_alloc(size, 0));
+}
+
+auto operator new(std::size_t size, std::align_val_t al) -> void* {
+    return checked(tracked_alloc(size, static_cast<std::size_t>(al)));
+}
+
+auto operator new[](std::size_t size, std::align_val_t al) -> void* {
+    return checked(tracked_alloc(size, static_cast<std::size_t>(al)));
+}
+
+auto operator new(std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    return tracked_alloc(size, 0);
+}
+
+auto operator new[](std::size_t size, const std::nothrow_t&) noexcept -> void* {
+    return tracked_alloc(size, 0);
+}
+
+auto operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept -> void* {
+    return tracked_alloc(size, static_cast<std::size_t>(al));
+}
+
+auto operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept -> void* {
+    return tracked_alloc(size, static_cast<std::size_t>(al));
+}
+
+auto operator delete(void* ptr) noexcept -> void {
+    tracked_free(ptr, 0);
+}
+
+auto operator delete[](void* ptr) noexcept -> void {
+    tracked_free(ptr, 0);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void {
+    tracked_free(ptr, 0);
+}
+
+auto operator delete[](void* ptr, std::size_t) noexcept -> void {
+    tracked_free(ptr, 0);
+}
+
+auto operator delete(void* ptr, std::align_val_t al) noexcept -> void {
+    tracked_free(ptr, static_cast<std::size_t>(al));
+}
+
+auto operator delete[](void* ptr, std::align_val_t al) noexcept -> void {
+    tracked_free(ptr, static_cast<std::size_t>(al));
+}
+
+auto operator delete(void* ptr, std::size_t, std::align_val_t al) noexcept -> void {
+    tracked_free(ptr, static_cast<std::size_t>(al));
+}
+
+auto operator delete[](void* ptr, std::size_t, std::align_val_t al) noexcept -> void {
+    tracked_free(ptr, static_cast<std::size_t>(al));
+}
+
+auto operator delete(void* ptr, const std::nothrow_t&) noexcept -> void {
+    tracked_free(ptr, 0);
+}
+
+auto operator delete[](void* ptr, const std::nothrow_t&) noexcept -> void {
+    tracked_free(ptr, 0);
+}
+
+auto operator delete(void* ptr, std::align_val_t al, const std::nothrow_t&) noexcept -> void {
+    tracked_free(ptr, static_cast<std::size_t>(al));
+}
+
+auto operator delete[](void* ptr, std::align_val_t al, const std::nothrow_t&) noexcept -> void {
+    tracked_free(ptr, static_cast<std::size_t>(al));
+}
+
+#endif
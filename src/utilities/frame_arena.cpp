@@ -0,0 +1,69 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "utilities/frame_arena.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+
+namespace vglx {
+
+namespace {
+
+constexpr auto kBlockAlignment = alignof(std::max_align_t);
+
+}
+
+LinearArena::LinearArena(std::size_t capacity) : capacity_(capacity) {
+    if (capacity_ > 0) {
+        block_ = static_cast<std::byte*>(upstream_->allocate(capacity_, kBlockAlignment));
+    }
+}
+
+auto LinearArena::Reset() -> void {
+    if (!overflow_.empty()) {
+        ReleaseOverflow();
+        // Grow to the high-water mark so the next frame of the same size fits
+        // entirely in one block. Alignment padding is covered by rounding up.
+        const auto capacity = std::max(capacity_ * 2, std::bit_ceil(used_));
+        if (block_) upstream_->deallocate(block_, capacity_, kBlockAlignment);
+        block_ = static_cast<std::byte*>(upstream_->allocate(capacity, kBlockAlignment));
+        capacity_ = capacity;
+    }
+    offset_ = 0;
+    used_ = 0;
+}
+
+auto LinearArena::do_allocate(std::size_t bytes, std::size_t alignment) -> void* {
+    used_ += bytes;
+
+    void* ptr = block_ + offset_;
+    auto space = capacity_ - offset_;
+    if (block_ && std::align(alignment, bytes, ptr, space)) {
+        offset_ = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - block_) + bytes;
+        return ptr;
+    }
+
+    ptr = upstream_->allocate(bytes, alignment);
+    overflow_.emplace_back(Overflow {ptr, bytes, alignment});
+    return ptr;
+}
+
+auto LinearArena::ReleaseOverflow() -> void {
+    for (const auto& overflow : overflow_) {
+        upstream_->deallocate(overflow.ptr, overflow.bytes, overflow.alignment);
+    }
+    overflow_.clear();
+}
+
+LinearArena::~LinearArena() {
+    ReleaseOverflow();
+    if (block_) upstream_->deallocate(block_, capacity_, kBlockAlignment);
+}
+
+}
@@ -0,0 +1,117 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace vglx {
+
+/**
+ * Bump allocator over a single block that is rewound as a whole.
+ *
+ * Deallocation is a no-op; memory is reclaimed by `Reset`. Requests that do
+ * not fit in the block are served by the upstream resource until the next
+ * reset, which then replaces the block with one large enough to hold the
+ * whole high-water mark. After a few frames the arena settles on a single
+ * block and stops reaching the global allocator.
+ */
+class LinearArena : public std::pmr::memory_resource {
+public:
+    explicit LinearArena(std::size_t capacity);
+
+    LinearArena(const LinearArena&) = delete;
+    auto operator=(const LinearArena&) -> LinearArena& = delete;
+
+    /// Releases every allocation made since the previous reset.
+    auto Reset() -> void;
+
+    /// Bytes requested since the previous reset, including overflow.
+    [[nodiscard]] auto Used() const { return used_; }
+
+    /// Size of the primary block.
+    [[nodiscard]] auto Capacity() const { return capacity_; }
+
+    /// True if a request since the previous reset did not fit the block.
+    [[nodiscard]] auto Overflowed() const { return !overflow_.empty(); }
+
+    ~LinearArena() override;
+
+private:
+    struct Overflow {
+        void* ptr;
+        std::size_t bytes;
+        std::size_t alignment;
+    };
+
+    std::pmr::memory_resource* upstream_ {std::pmr::new_delete_resource()};
+
+    std::byte* block_ {nullptr};
+
+    std::size_t capacity_ {0};
+
+    std::size_t offset_ {0};
+
+    std::size_t used_ {0};
+
+    std::vector<Overflow> overflow_;
+
+    auto ReleaseOverflow() -> void;
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override;
+
+    auto do_deallocate(void*, std::size_t, std::size_t) -> void override {}
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+        return this == &other;
+    }
+};
+
+/**
+ * Double-buffered arena for transient per-frame data.
+ *
+ * `BeginFrame` flips to the other arena and rewinds it, so memory handed out
+ * during a frame stays valid until the end of the following frame. Containers
+ * built on `Resource()` must be discarded, not cleared and reused, once their
+ * frame is over; their storage belongs to the arena that gets rewound.
+ */
+class FrameArena {
+public:
+    static constexpr auto kDefaultCapacity = std::size_t {64 * 1024};
+
+    explicit FrameArena(std::size_t capacity = kDefaultCapacity)
+      : front_(capacity), back_(capacity) {}
+
+    FrameArena(const FrameArena&) = delete;
+    auto operator=(const FrameArena&) -> FrameArena& = delete;
+
+    auto BeginFrame() -> void {
+        std::swap(current_, previous_);
+        current_->Reset();
+    }
+
+    /// Memory resource for allocations that live until the next frame ends.
+    [[nodiscard]] auto Resource() -> std::pmr::memory_resource* { return current_; }
+
+    [[nodiscard]] auto Current() const -> const LinearArena& { return *current_; }
+
+    [[nodiscard]] auto Previous() const -> const LinearArena& { return *previous_; }
+
+private:
+    LinearArena front_;
+
+    LinearArena back_;
+
+    LinearArena* current_ {&front_};
+
+    LinearArena* previous_ {&back_};
+};
+
+}
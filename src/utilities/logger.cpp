@@ -7,13 +7,38 @@
 
 #include "utilities/logger.hpp"
 
+#include "vglx/utilities/timer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
 namespace vglx {
 
 namespace fs = std::filesystem;
 
-std::mutex Logger::mutex_;
+namespace {
+
+constexpr auto kQueueCapacity = std::size_t {512};
+
+constexpr auto kCallSiteCapacity = std::size_t {512};
+
+constexpr auto kCallSiteProbes = std::size_t {8};
 
-auto Logger::ToString(LogLevel level) -> std::string {
+constexpr auto kIdleInterval = std::chrono::milliseconds {20};
+
+static_assert((kQueueCapacity & (kQueueCapacity - 1)) == 0);
+static_assert((kCallSiteCapacity & (kCallSiteCapacity - 1)) == 0);
+
+auto to_string(LogLevel level) -> std::string_view {
     using enum LogLevel;
     switch (level) {
         case Error:    return "\033[1;31m[Error]\033[0m";
@@ -24,4 +49,314 @@ auto Logger::ToString(LogLevel level) -> std::string {
     }
 }
 
-}
\ No newline at end of file
+struct Entry {
+    std::atomic<std::size_t> sequence {0};
+    LogLevel level {LogLevel::Debug};
+    const char* file {nullptr};
+    uint32_t line {0};
+    uint32_t suppressed {0};
+    std::size_t length {0};
+    std::array<char, Logger::kMaxMessageLength> text;
+    // Messages that do not fit in `text`, released once written.
+    std::string overflow;
+
+    [[nodiscard]] auto Message() const -> std::string_view {
+        return overflow.empty() ? std::string_view {text.data(), length} : overflow;
+    }
+};
+
+/**
+ * Rate limiting state of a single call site. A zero key marks a free slot.
+ * Updates race benignly: at worst a message more or less gets through when
+ * several threads cross a window boundary at once.
+ */
+struct CallSite {
+    std::atomic<uintptr_t> key {0};
+    std::atomic<int64_t> window_start {0};
+    std::atomic<uint32_t> count {0};
+    std::atomic<uint32_t> suppressed {0};
+};
+
+/**
+ * Bounded multi-producer, single-consumer queue. Each entry carries a
+ * sequence number that tells producers whether it is free for the lap they
+ * claimed and tells the consumer whether it has been published, so neither
+ * side ever takes a lock.
+ */
+struct Queue {
+    std::unique_ptr<Entry[]> entries {std::make_unique<Entry[]>(kQueueCapacity)};
+    std::atomic<std::size_t> enqueue_pos {0};
+    std::size_t dequeue_pos {0};
+    std::atomic<std::size_t> written {0};
+    std::atomic<std::size_t> dropped {0};
+
+    Queue() {
+        for (auto i = 0uz; i < kQueueCapacity; ++i) {
+            entries[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    auto Claim() -> Entry* {
+        auto pos = enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& entry = entries[pos & (kQueueCapacity - 1)];
+            const auto seq = entry.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return &entry;
+                }
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    static auto Publish(Entry* entry) -> void {
+        const auto seq = entry->sequence.load(std::memory_order_relaxed);
+        entry->sequence.store(seq + 1, std::memory_order_release);
+    }
+
+    auto Front() -> Entry* {
+        auto& entry = entries[dequeue_pos & (kQueueCapacity - 1)];
+        const auto seq = entry.sequence.load(std::memory_order_acquire);
+        return seq == dequeue_pos + 1 ? &entry : nullptr;
+    }
+
+    auto Pop(Entry* entry) -> void {
+        entry->sequence.store(dequeue_pos + kQueueCapacity, std::memory_order_release);
+        ++dequeue_pos;
+    }
+};
+
+// Set once the logger's statics are being destroyed.
+auto exiting = std::atomic<bool> {false};
+
+struct Worker {
+    Queue queue;
+    std::array<CallSite, kCallSiteCapacity> call_sites;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::atomic<bool> idle {false};
+    std::atomic<bool> stopping {false};
+    std::atomic<bool> stopped {false};
+    std::thread thread;
+
+    Worker() {
+        if (exiting.load()) {
+            stopped.store(true);
+            return;
+        }
+        thread = std::thread([this] { Run(); });
+    }
+
+    auto Notify() -> void {
+        if (idle.load(std::memory_order_relaxed)) wake.notify_one();
+    }
+
+    auto Run() -> void {
+        while (true) {
+            Drain();
+            if (stopping.load()) {
+                Drain();
+                return;
+            }
+            // Producers only notify while the worker is idle and never take
+            // the mutex, so a wakeup can be missed; the timeout bounds the
+            // latency of a missed wakeup.
+            auto lock = std::unique_lock {mutex};
+            idle.store(true);
+            wake.wait_for(lock, kIdleInterval, [this] {
+                return queue.Front() != nullptr || stopping.load();
+            });
+            idle.store(false);
+        }
+    }
+
+    auto Drain() -> void {
+        auto wrote = false;
+        while (auto entry = queue.Front()) {
+            Write(entry->level, entry->Message(), entry->file, entry->line, entry->suppressed);
+            if (!entry->overflow.empty()) std::string {}.swap(entry->overflow);
+            queue.Pop(entry);
+            wrote = true;
+        }
+        if (!wrote) return;
+
+        std::cout.flush();
+        std::cerr.flush();
+        queue.written.store(queue.dequeue_pos);
+        queue.written.notify_all();
+    }
+
+    auto Write(
+        LogLevel level,
+        std::string_view message,
+        const char* file,
+        uint32_t line,
+        uint32_t suppressed
+    ) -> void {
+        auto stream = level == LogLevel::Error ? &std::cerr : &std::cout;
+        const auto path = fs::path {file};
+
+        if (const auto dropped = queue.dropped.exchange(0)) {
+            std::cerr << std::format("[{}] {} log messages dropped, queue full\n", Timer::GetTimestamp(), dropped);
+        }
+
+        *stream << std::format(
+            "[{}]{}: {} -> {}:{}\n",
+            Timer::GetTimestamp(),
+            to_string(level),
+            message,
+            path.filename().string(),
+            line
+        );
+
+        if (suppressed > 0) {
+            *stream << std::format(
+                "[{}]{}: {} similar messages suppressed -> {}:{}\n",
+                Timer::GetTimestamp(),
+                to_string(level),
+                suppressed,
+                path.filename().string(),
+                line
+            );
+        }
+    }
+
+    /// Joins the worker thread. Messages logged afterwards are written by
+    /// the calling thread.
+    auto Stop() -> void {
+        stopping.store(true);
+        wake.notify_one();
+        thread.join();
+        Drain();
+        stopped.store(true);
+    }
+};
+
+// Never destroyed, so objects destroyed after the logger's own statics can
+// still log. The thread is joined by `shutdown` below.
+auto worker_instance = std::atomic<Worker*> {nullptr};
+
+auto worker() -> Worker& {
+    static const auto instance = [] {
+        auto w = new Worker {};
+        worker_instance.store(w, std::memory_order_release);
+        return w;
+    }();
+    return *instance;
+}
+
+// Stops the worker thread during static destruction, after writing every
+// message still in the queue.
+struct Shutdown {
+    ~Shutdown() {
+        exiting.store(true);
+        if (auto w = worker_instance.load(std::memory_order_acquire)) w->Stop();
+    }
+} shutdown;
+
+auto now_ms() -> int64_t {
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+auto find_call_site(Worker& w, const std::source_location& loc) -> CallSite* {
+    // File name literals have static storage, so the pointer and line
+    // identify a call site without hashing strings.
+    auto key = reinterpret_cast<uintptr_t>(loc.file_name()) * 31 + loc.line();
+    if (key == 0) key = 1;
+
+    const auto hash = key * 0x9E3779B97F4A7C15ull;
+    for (auto i = 0uz; i < kCallSiteProbes; ++i) {
+        auto& site = w.call_sites[(hash + i) & (kCallSiteCapacity - 1)];
+        auto current = site.key.load(std::memory_order_acquire);
+        if (current == 0 && site.key.compare_exchange_strong(current, key)) {
+            return &site;
+        }
+        if (current == key) return &site;
+    }
+    return nullptr;
+}
+
+}
+
+auto Logger::Admit(
+    LogLevel level,
+    const std::source_location& loc,
+    uint32_t& suppressed
+) -> bool {
+    auto site = find_call_site(worker(), loc);
+    // Sites that do not fit in the table are never limited.
+    if (site == nullptr) return true;
+
+    const auto now = now_ms();
+    auto start = site->window_start.load(std::memory_order_relaxed);
+    if (now - start >= kRateLimitWindowMs &&
+        site->window_start.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+        suppressed = site->suppressed.exchange(0, std::memory_order_relaxed);
+        site->count.store(0, std::memory_order_relaxed);
+    }
+
+    const auto budget = level == LogLevel::Error ? kMaxErrorsPerWindow : kMaxMessagesPerWindow;
+    if (site->count.fetch_add(1, std::memory_order_relaxed) < budget) {
+        return true;
+    }
+    site->suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+auto Logger::Enqueue(
+    LogLevel level,
+    std::string_view message,
+    const std::source_location& loc,
+    uint32_t suppressed
+) -> void {
+    auto& w = worker();
+    if (w.stopped.load(std::memory_order_acquire)) {
+        const auto lock = std::scoped_lock(w.mutex);
+        w.Write(level, message, loc.file_name(), loc.line(), suppressed);
+        (level == LogLevel::Error ? std::cerr : std::cout).flush();
+        return;
+    }
+
+    auto entry = w.queue.Claim();
+    if (entry == nullptr) {
+        w.queue.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    entry->level = level;
+    entry->file = loc.file_name();
+    entry->line = loc.line();
+    entry->suppressed = suppressed;
+    if (message.size() > kMaxMessageLength) {
+        entry->length = 0;
+        entry->overflow.assign(message);
+    } else {
+        entry->length = message.size();
+        std::memcpy(entry->text.data(), message.data(), entry->length);
+    }
+    Queue::Publish(entry);
+
+    w.Notify();
+}
+
+auto Logger::Flush() -> void {
+    auto& w = worker();
+    if (w.stopped.load(std::memory_order_acquire)) return;
+
+    const auto target = w.queue.enqueue_pos.load();
+    w.wake.notify_one();
+
+    auto written = w.queue.written.load();
+    while (written < target) {
+        w.queue.written.wait(written);
+        written = w.queue.written.load();
+    }
+}
+
+}
@@ -8,19 +8,18 @@
 #pragma once
 
 #include "vglx/core/identity.hpp"
-#include "vglx/utilities/timer.hpp"
 
-#include <filesystem>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <format>
-#include <iostream>
-#include <mutex>
+#include <iterator>
 #include <source_location>
 #include <string>
+#include <string_view>
 
 namespace vglx {
 
-namespace fs = std::filesystem;
-
 enum class LogLevel {
     Error,
     Warning,
@@ -28,8 +27,44 @@ enum class LogLevel {
     Debug
 };
 
+// Most verbose level compiled into the library. Calls above it are removed
+// at compile time, formatting included, since every call site passes its
+// level as a constant.
+#if defined(VGLX_LOG_LEVEL)
+inline constexpr auto kMaxLogLevel = static_cast<LogLevel>(VGLX_LOG_LEVEL);
+#elif defined(NDEBUG)
+inline constexpr auto kMaxLogLevel = LogLevel::Warning;
+#else
+inline constexpr auto kMaxLogLevel = LogLevel::Debug;
+#endif
+
+/**
+ * Asynchronous logger.
+ *
+ * Messages are formatted on the calling thread into a fixed-size buffer and
+ * pushed to a lock-free ring buffer that a background thread drains to
+ * `std::cout` and `std::cerr`. Logging never blocks; if the ring is full the
+ * message is dropped and the drop is reported with the next message written.
+ * Messages longer than `kMaxMessageLength`, such as shader info logs, are
+ * formatted again into a heap string so they are never cut short.
+ *
+ * Each call site may log `kMaxMessagesPerWindow` messages per
+ * `kRateLimitWindowMs`. Further messages are discarded before formatting and
+ * reported as a suppressed count once the window rolls over, so a call
+ * that fires for every object every frame costs little more than a clock read.
+ * Errors get a larger budget of `kMaxErrorsPerWindow`, so a burst of
+ * distinct failures is still visible.
+ */
 class Logger {
 public:
+    static constexpr auto kMaxMessageLength = std::size_t {256};
+
+    static constexpr auto kMaxMessagesPerWindow = uint32_t {5};
+
+    static constexpr auto kMaxErrorsPerWindow = uint32_t {20};
+
+    static constexpr auto kRateLimitWindowMs = int64_t {1000};
+
     template <typename... Args>
     struct Log {
         Log(
@@ -38,25 +73,27 @@ public:
             Args&&... args,
             const std::source_location& loc = std::source_location::current()
         ) {
-            const auto lock = std::scoped_lock(mutex_);
+            if (!Logger::IsEnabled(level)) return;
+
+            auto suppressed = uint32_t {0};
+            if (!Logger::Admit(level, loc, suppressed)) return;
 
-            auto stream = level == LogLevel::Error ? &std::cerr : &std::cout;
-            const auto& path = fs::path{loc.file_name()};
-            // std::format needs a compile-time string; std::vformat allows
+            // std::format needs a compile-time string; std::vformat_to allows
             // runtime strings using format args.
-            const auto message = std::vformat(
+            const auto format_args = std::make_format_args(static_cast<const Args&>(args)...);
+            std::array<char, kMaxMessageLength> buffer;
+            const auto out = std::vformat_to(
+                BoundedOutput {buffer.data(), buffer.data() + buffer.size()},
                 format_str,
-                std::make_format_args(static_cast<const Args&>(args)...)
+                format_args
             );
 
-            *stream << std::format(
-                "[{}]{}: {} -> {}:{}\n",
-                Timer::GetTimestamp(),
-                Logger::ToString(level),
-                message,
-                path.filename().string(),
-                loc.line()
-            );
+            if (out.size > buffer.size()) {
+                Logger::Enqueue(level, std::vformat(format_str, format_args), loc, suppressed);
+                return;
+            }
+
+            Logger::Enqueue(level, {buffer.data(), out.size}, loc, suppressed);
         }
 
         Log(
@@ -72,10 +109,45 @@ public:
     template <typename... Args>
     Log(std::string_view message, Args&&...) -> Log<Args...>;
 
+    [[nodiscard]] static constexpr auto IsEnabled(LogLevel level) {
+        return level <= kMaxLogLevel;
+    }
+
+    /// Blocks until every message logged so far has been written.
+    static auto Flush() -> void;
+
 private:
-    static std::mutex mutex_;
+    // Output iterator that stops writing at the end of the buffer but keeps
+    // counting, so callers can tell when the message did not fit.
+    struct BoundedOutput {
+        using difference_type = std::ptrdiff_t;
+
+        char* it;
+        char* end;
+        std::size_t size {0};
+
+        auto operator*() -> BoundedOutput& { return *this; }
+        auto operator=(char c) -> BoundedOutput& {
+            if (it != end) *it++ = c;
+            ++size;
+            return *this;
+        }
+        auto operator++() -> BoundedOutput& { return *this; }
+        auto operator++(int) -> BoundedOutput& { return *this; }
+    };
 
-    [[nodiscard]] static auto ToString(LogLevel level) -> std::string;
+    [[nodiscard]] static auto Admit(
+        LogLevel level,
+        const std::source_location& loc,
+        uint32_t& suppressed
+    ) -> bool;
+
+    static auto Enqueue(
+        LogLevel level,
+        std::string_view message,
+        const std::source_location& loc,
+        uint32_t suppressed
+    ) -> void;
 };
 
 }
@@ -88,7 +160,7 @@ struct formatter<T, enable_if_t<std::is_base_of_v<vglx::Identity, T>, char>> {
     template <typename FormatContext>
     auto format(const T& obj, FormatContext& ctx) const {
         return obj.Name().empty() ?
-            std::format_to(ctx.out(), "[UUID: {}]", obj.UUID()) :
+            std::format_to(ctx.out(), "[ID: {}]", obj.Id()) :
             std::format_to(ctx.out(), "[Name: {}]", obj.Name());
     }
 };
@@ -0,0 +1,282 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include "vglx/utilities/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace vglx {
+
+namespace {
+
+struct ZoneEvent {
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+};
+
+/**
+ * Zones recorded by a single thread. Only the owning thread writes to the
+ * buffer; it publishes each event by a release store of `size`, so readers
+ * never see a partially written event. A buffer whose generation is older
+ * than the registry's belongs to a previous capture and is reset lazily by
+ * its owner on the next write.
+ */
+struct ThreadBuffer {
+    std::unique_ptr<ZoneEvent[]> events;
+    std::atomic<std::size_t> size {0};
+    std::atomic<std::size_t> dropped {0};
+    std::atomic<uint64_t> generation {0};
+    uint32_t thread_id {0};
+    bool retired {false};
+};
+
+/// Full-size event arrays kept for threads started after others exit.
+constexpr auto kMaxPooledEvents = std::size_t {4};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::vector<std::unique_ptr<ZoneEvent[]>> pool;
+    std::atomic<bool> capturing {false};
+    std::atomic<uint64_t> generation {0};
+    std::atomic<uint64_t> epoch {0};
+    std::size_t allocated {0};
+    uint32_t next_thread_id {0};
+};
+
+auto registry() -> Registry& {
+    static auto instance = Registry {};
+    return instance;
+}
+
+auto now() -> uint64_t {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()
+    ).count());
+}
+
+auto acquire_events(Registry& r) -> std::unique_ptr<ZoneEvent[]> {
+    if (!r.pool.empty()) {
+        auto events = std::move(r.pool.back());
+        r.pool.pop_back();
+        return events;
+    }
+    ++r.allocated;
+    return std::make_unique<ZoneEvent[]>(Profiler::kMaxZonesPerThread);
+}
+
+auto release_events(Registry& r, std::unique_ptr<ZoneEvent[]> events) -> void {
+    if (r.pool.size() < kMaxPooledEvents) {
+        r.pool.emplace_back(std::move(events));
+    } else {
+        --r.allocated;
+    }
+}
+
+/**
+ * Hands the thread's buffer back when the thread exits. Zones it recorded
+ * during the current capture are flushed into an array sized to fit, so the
+ * trace still contains them, and the full-size array returns to the pool.
+ */
+struct LocalBuffer {
+    ThreadBuffer* buffer {nullptr};
+
+    ~LocalBuffer() {
+        if (!buffer) return;
+        auto& r = registry();
+        const auto lock = std::scoped_lock(r.mutex);
+        const auto current = buffer->generation.load(std::memory_order_relaxed) ==
+                             r.generation.load(std::memory_order_relaxed);
+        const auto n = current ? buffer->size.load(std::memory_order_relaxed) : 0;
+
+        if (n == 0 && (!current || buffer->dropped.load(std::memory_order_relaxed) == 0)) {
+            release_events(r, std::move(buffer->events));
+            std::erase_if(r.buffers, [&](const auto& b) { return b.get() == buffer; });
+            return;
+        }
+
+        auto flushed = std::make_unique<ZoneEvent[]>(n);
+        std::copy_n(buffer->events.get(), n, flushed.get());
+        release_events(r, std::exchange(buffer->events, std::move(flushed)));
+        buffer->retired = true;
+    }
+};
+
+auto local_buffer() -> ThreadBuffer* {
+    // Buffers are owned by the registry so zones recorded by a thread
+    // remain available after it exits.
+    thread_local auto local = LocalBuffer {};
+    if (!local.buffer) {
+        auto& r = registry();
+        const auto lock = std::scoped_lock(r.mutex);
+        auto& entry = r.buffers.emplace_back(std::make_unique<ThreadBuffer>());
+        entry->events = acquire_events(r);
+        entry->thread_id = ++r.next_thread_id;
+        local.buffer = entry.get();
+    }
+    return local.buffer;
+}
+
+auto record(const char* name, uint64_t start, uint64_t end) -> void {
+    auto buffer = local_buffer();
+    const auto generation = registry().generation.load(std::memory_order_acquire);
+    if (buffer->generation.load(std::memory_order_relaxed) != generation) {
+        buffer->size.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+        buffer->generation.store(generation, std::memory_order_release);
+    }
+
+    const auto n = buffer->size.load(std::memory_order_relaxed);
+    if (n == Profiler::kMaxZonesPerThread) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer->events[n] = {name, start, end};
+    buffer->size.store(n + 1, std::memory_order_release);
+}
+
+/// Calls `fn(buffer, count)` for every buffer written during the current capture.
+template <typename Fn>
+auto for_each_buffer(Fn&& fn) -> void {
+    auto& r = registry();
+    const auto lock = std::scoped_lock(r.mutex);
+    const auto generation = r.generation.load(std::memory_order_acquire);
+    for (const auto& buffer : r.buffers) {
+        if (buffer->generation.load(std::memory_order_acquire) != generation) continue;
+        fn(*buffer, buffer->size.load(std::memory_order_acquire));
+    }
+}
+
+auto write_escaped(std::ostream& out, const char* str) -> void {
+    for (auto c = str; *c; ++c) {
+        switch (*c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) >= 0x20) out << *c;
+        }
+    }
+}
+
+}
+
+Profiler::Zone::Zone(const char* name) : name_(name) {
+    if (registry().capturing.load(std::memory_order_relaxed)) {
+        start_ = now();
+    }
+}
+
+Profiler::Zone::~Zone() {
+    // Zones opened during a capture are recorded even if the capture ended
+    // in the meantime, so nested zones are never cut in half.
+    if (start_) record(name_, start_, now());
+}
+
+auto Profiler::BeginCapture() -> void {
+    auto& r = registry();
+    {
+        // Threads that exited only held on to zones from the previous capture
+        const auto lock = std::scoped_lock(r.mutex);
+        std::erase_if(r.buffers, [](const auto& buffer) { return buffer->retired; });
+    }
+    r.epoch.store(now(), std::memory_order_relaxed);
+    r.generation.fetch_add(1, std::memory_order_release);
+    r.capturing.store(true, std::memory_order_release);
+}
+
+auto Profiler::EndCapture() -> void {
+    registry().capturing.store(false, std::memory_order_release);
+}
+
+auto Profiler::IsCapturing() -> bool {
+    return registry().capturing.load(std::memory_order_acquire);
+}
+
+auto Profiler::RecordedZones() -> std::size_t {
+    auto count = std::size_t {0};
+    for_each_buffer([&](const ThreadBuffer&, std::size_t n) { count += n; });
+    return count;
+}
+
+auto Profiler::DroppedZones() -> std::size_t {
+    auto count = std::size_t {0};
+    for_each_buffer([&](const ThreadBuffer& buffer, std::size_t) {
+        count += buffer.dropped.load(std::memory_order_relaxed);
+    });
+    return count;
+}
+
+auto Profiler::AllocatedBuffers() -> std::size_t {
+    auto& r = registry();
+    const auto lock = std::scoped_lock(r.mutex);
+    return r.allocated;
+}
+
+auto Profiler::ToChromeTrace() -> std::string {
+    const auto epoch = registry().epoch.load(std::memory_order_relaxed);
+    const auto to_us = [](uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+
+    auto out = std::ostringstream {};
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    auto first = true;
+    const auto separator = [&] {
+        if (!first) out << ',';
+        first = false;
+    };
+
+    for_each_buffer([&](const ThreadBuffer& buffer, std::size_t n) {
+        separator();
+        out << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer.thread_id
+            << ",\"args\":{\"name\":\"Thread " << buffer.thread_id << "\"}}";
+
+        for (auto i = std::size_t {0}; i < n; ++i) {
+            const auto& event = buffer.events[i];
+            // Zones opened before the capture began
+            if (event.start < epoch) continue;
+            separator();
+            out << "\n{\"name\":\"";
+            write_escaped(out, event.name);
+            out << "\",\"cat\":\"vglx\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer.thread_id
+                << ",\"ts\":" << to_us(event.start - epoch)
+                << ",\"dur\":" << to_us(event.end - event.start) << '}';
+        }
+    });
+
+    out << "\n]}\n";
+    return out.str();
+}
+
+auto Profiler::WriteChromeTrace(const fs::path& path) -> std::expected<void, std::string> {
+    auto file = std::ofstream {path, std::ios::binary};
+    if (!file) {
+        return std::unexpected("Failed to open trace file for writing: " + path.string());
+    }
+
+    file << ToChromeTrace();
+    if (!file) {
+        return std::unexpected("Failed to write trace file: " + path.string());
+    }
+
+    return {};
+}
+
+}
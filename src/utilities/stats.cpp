@@ -7,10 +7,16 @@
 
 #include "vglx/utilities/stats.hpp"
 
+#include "vglx/utilities/allocation_tracker.hpp"
 #include "vglx/utilities/timer.hpp"
 
 #include "utilities/data_series.hpp"
 
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
 #ifdef VGLX_USE_IMGUI
 #include <imgui/imgui.h>
 #endif
@@ -18,49 +24,180 @@
 namespace vglx {
 
 static const float kContainerWidth {250.0f};
-static const float kContainerHeight {215.0f};
+static const float kContainerHeight {362.0f};
+
+namespace {
+
+// Nearest-rank percentile; reorders `values`.
+auto percentile(std::vector<double>& values, double p) -> double {
+    if (values.empty()) return 0.0;
+    const auto rank = static_cast<std::size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+    std::ranges::nth_element(values, values.begin() + rank);
+    return values[rank];
+}
+
+}
 
 struct Stats::Impl {
     DataSeries<float, 150> fps_series;
     DataSeries<float, 150> frame_time_series;
+    DataSeries<float, 150> gpu_time_series;
     DataSeries<float, 150> rendered_objects_series;
 
+    Stats::Parameters params;
+
+    // Ring buffer of the most recent frames, `head` is the oldest once full.
+    std::vector<FrameSample> samples;
+    std::size_t head = 0;
+    std::size_t frame_index = 0;
+
+    Stats::Summary summary {};
+
+    // Scratch space for percentiles, reused so summaries do not allocate.
+    mutable std::vector<double> times;
+    mutable std::vector<double> gpu_times;
+
+    Stats::ReportCallback report_callback;
+    double report_interval = 0.0;
+    double last_report = 0.0;
+
     Timer timer {true};
 
     double last_flush = 0.0;
-    double frame_start = 0.0;
+    double frame_start = -1.0;
+    double frame_interval = 0.0;
     double frame_time = 0.0;
+    double average_interval = 0.0;
+
+    Renderer::GPUTimings gpu_timings {};
+
+    std::size_t frame_allocations = 0;
+    std::size_t allocations_at_start = 0;
 
     unsigned last_objects = 0;
     unsigned frame_count = 0;
 
-    Impl() {
-        last_flush = timer.GetElapsedMilliseconds();
+    explicit Impl(const Stats::Parameters& params) : params(params) {
+        samples.reserve(params.capacity);
+        times.reserve(params.capacity);
+        gpu_times.reserve(params.capacity);
+        last_flush = Now();
+        last_report = last_flush;
+    }
+
+    auto Now() const -> double {
+        return timer.GetElapsedSeconds() * 1000.0;
     }
 
     auto Before() {
-        const auto now = timer.GetElapsedMilliseconds();
+        const auto now = Now();
 
         while (now - last_flush >= 1000.0) {
+#ifdef VGLX_USE_IMGUI
+            summary = Summarize();
+#endif
             fps_series.Push(static_cast<float>(frame_count));
             frame_time_series.Push(static_cast<float>(frame_time));
+            gpu_time_series.Push(static_cast<float>(gpu_timings.total));
             rendered_objects_series.Push(last_objects);
             frame_count = 0;
             last_flush += 1000.0;
         }
 
+        if (report_callback && now - last_report >= report_interval * 1000.0) {
+            report_callback(Summarize());
+            last_report = now;
+        }
+
+        const auto allocations = AllocationTracker::ThreadAllocations();
+        frame_allocations = allocations - allocations_at_start;
+        allocations_at_start = allocations;
+
+        frame_interval = frame_start < 0.0 ? 0.0 : now - frame_start;
         frame_start = now;
         ++frame_count;
     }
 
     auto After(unsigned int n_objects) {
-        const auto frame_end = timer.GetElapsedMilliseconds();
+        const auto frame_end = Now();
         frame_time = frame_end - frame_start;
         last_objects = n_objects;
+
+        // The first frame has no previous frame to measure against.
+        if (frame_interval > 0.0) Record(frame_interval);
+    }
+
+    auto Record(double interval) -> void {
+        const auto hitch =
+            interval > params.hitch_threshold ||
+            (params.hitch_ratio > 0.0 && average_interval > 0.0 &&
+             interval > average_interval * params.hitch_ratio);
+
+        // Hitches are left out of the running average so that a burst of
+        // slow frames does not raise the bar for detecting the next one.
+        if (!hitch) {
+            average_interval = average_interval == 0.0
+                ? interval
+                : average_interval + (interval - average_interval) * 0.05;
+        }
+
+        const auto sample = FrameSample {
+            .frame = frame_index++,
+            .frame_time = interval,
+            .render_time = frame_time,
+            .gpu_time = gpu_timings.available ? gpu_timings.total : 0.0,
+            .objects = last_objects,
+            .allocations = frame_allocations,
+            .hitch = hitch
+        };
+
+        if (params.capacity == 0) return;
+        if (samples.size() < params.capacity) {
+            samples.emplace_back(sample);
+        } else {
+            samples[head] = sample;
+            head = (head + 1) % params.capacity;
+        }
+    }
+
+    auto Ordered() const -> std::vector<FrameSample> {
+        auto output = std::vector<FrameSample> {};
+        output.reserve(samples.size());
+        output.insert(output.end(), samples.begin() + head, samples.end());
+        output.insert(output.end(), samples.begin(), samples.begin() + head);
+        return output;
+    }
+
+    auto Summarize() const -> Stats::Summary {
+        auto output = Stats::Summary {.frames = samples.size()};
+        if (samples.empty()) return output;
+
+        times.clear();
+        gpu_times.clear();
+
+        auto sum = 0.0;
+        for (const auto& sample : samples) {
+            times.emplace_back(sample.frame_time);
+            if (sample.gpu_time > 0.0) gpu_times.emplace_back(sample.gpu_time);
+            sum += sample.frame_time;
+            if (sample.hitch) ++output.hitches;
+            output.max_allocations = std::max(output.max_allocations, sample.allocations);
+        }
+
+        output.average = sum / static_cast<double>(samples.size());
+        output.max = std::ranges::max(times);
+        output.p50 = percentile(times, 0.50);
+        output.p95 = percentile(times, 0.95);
+        output.p99 = percentile(times, 0.99);
+        output.gpu_p50 = percentile(gpu_times, 0.50);
+        output.gpu_p95 = percentile(gpu_times, 0.95);
+        return output;
     }
 };
 
-Stats::Stats() : impl_(std::make_unique<Stats::Impl>()) {}
+Stats::Stats() : Stats(Parameters {}) {}
+
+Stats::Stats(const Parameters& params) : impl_(std::make_unique<Stats::Impl>(params)) {}
 
 auto Stats::BeforeRender() -> void {
     impl_->Before();
@@ -70,6 +207,102 @@ auto Stats::AfterRender(unsigned int n_objects) -> void {
     impl_->After(n_objects);
 }
 
+auto Stats::RecordGPUTimings(const Renderer::GPUTimings& timings) -> void {
+    impl_->gpu_timings = timings;
+}
+
+auto Stats::GetSummary() const -> Summary {
+    return impl_->Summarize();
+}
+
+auto Stats::GetSamples() const -> std::vector<FrameSample> {
+    return impl_->Ordered();
+}
+
+auto Stats::ToCSV() const -> std::string {
+    auto out = std::ostringstream {};
+    out << std::fixed << std::setprecision(3);
+    out << "frame,frame_time_ms,render_time_ms,gpu_time_ms,objects,allocations,hitch\n";
+    for (const auto& sample : impl_->Ordered()) {
+        out << sample.frame << ','
+            << sample.frame_time << ','
+            << sample.render_time << ','
+            << sample.gpu_time << ','
+            << sample.objects << ','
+            << sample.allocations << ','
+            << (sample.hitch ? 1 : 0) << '\n';
+    }
+    return out.str();
+}
+
+auto Stats::ToJSON() const -> std::string {
+    const auto summary = impl_->Summarize();
+
+    auto out = std::ostringstream {};
+    out << std::fixed << std::setprecision(3);
+    out << "{\n  \"summary\": {"
+        << "\"frames\": " << summary.frames
+        << ", \"hitches\": " << summary.hitches
+        << ", \"average_ms\": " << summary.average
+        << ", \"p50_ms\": " << summary.p50
+        << ", \"p95_ms\": " << summary.p95
+        << ", \"p99_ms\": " << summary.p99
+        << ", \"max_ms\": " << summary.max
+        << ", \"gpu_p50_ms\": " << summary.gpu_p50
+        << ", \"gpu_p95_ms\": " << summary.gpu_p95
+        << ", \"max_allocations\": " << summary.max_allocations
+        << "},\n  \"frames\": [";
+
+    auto first = true;
+    for (const auto& sample : impl_->Ordered()) {
+        out << (first ? "\n" : ",\n")
+            << "    {\"frame\": " << sample.frame
+            << ", \"frame_time_ms\": " << sample.frame_time
+            << ", \"render_time_ms\": " << sample.render_time
+            << ", \"gpu_time_ms\": " << sample.gpu_time
+            << ", \"objects\": " << sample.objects
+            << ", \"allocations\": " << sample.allocations
+            << ", \"hitch\": " << (sample.hitch ? "true" : "false") << '}';
+        first = false;
+    }
+
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+auto Stats::Write(const fs::path& path) const -> std::expected<void, std::string> {
+    const auto extension = path.extension();
+    if (extension != ".csv" && extension != ".json") {
+        return std::unexpected("Unsupported stats format '" + extension.string() + "', use .csv or .json");
+    }
+
+    auto file = std::ofstream {path, std::ios::binary};
+    if (!file) {
+        return std::unexpected("Failed to open stats file for writing: " + path.string());
+    }
+
+    file << (extension == ".csv" ? ToCSV() : ToJSON());
+    if (!file) {
+        return std::unexpected("Failed to write stats file: " + path.string());
+    }
+
+    return {};
+}
+
+auto Stats::OnReport(ReportCallback callback, double interval) -> void {
+    impl_->report_callback = std::move(callback);
+    impl_->report_interval = interval;
+    impl_->last_report = impl_->Now();
+}
+
+auto Stats::Reset() -> void {
+    impl_->samples.clear();
+    impl_->head = 0;
+    impl_->frame_index = 0;
+    impl_->average_interval = 0.0;
+    impl_->summary = {};
+}
+
 auto Stats::Draw() const -> void {
 #ifdef VGLX_USE_IMGUI
     const auto window_width = ImGui::GetIO().DisplaySize.x;
@@ -92,13 +325,43 @@ auto Stats::Draw() const -> void {
 
     // frame time
     ImGui::PushStyleColor(ImGuiCol_PlotHistogram, {0.40f, 0.70f, 0.20f, 1.0f});
-    ImGui::Text("Frame Time: %.0fms", impl_->frame_time_series.LastValue());
+    ImGui::Text("Frame Time: %.1fms", impl_->frame_time_series.LastValue());
     ImGui::PlotHistogram(
         "##Frame Time",
         impl_->frame_time_series.Buffer(), 150, 0, nullptr, 0.0f, 10.0f, {235, 40}
     );
     ImGui::PopStyleColor();
 
+    // frame time percentiles
+    const auto& summary = impl_->summary;
+    ImGui::Text("p50 %.1f  p95 %.1f  p99 %.1f", summary.p50, summary.p95, summary.p99);
+    ImGui::Text("Max %.1fms  Hitches %zu", summary.max, summary.hitches);
+    if (AllocationTracker::IsEnabled()) {
+        ImGui::Text("Allocations: %zu/frame", impl_->frame_allocations);
+    } else {
+        ImGui::Text("Allocations: n/a");
+    }
+
+    // gpu time
+    const auto& gpu = impl_->gpu_timings;
+    ImGui::PushStyleColor(ImGuiCol_PlotHistogram, {0.85f, 0.55f, 0.10f, 1.0f});
+    if (gpu.available) {
+        ImGui::Text(
+            "GPU Time: %.2fms (%s bound)",
+            gpu.total,
+            gpu.total > impl_->frame_time ? "GPU" : "CPU"
+        );
+    } else {
+        ImGui::Text("GPU Time: n/a");
+    }
+    ImGui::PlotHistogram(
+        "##GPU Time",
+        impl_->gpu_time_series.Buffer(), 150, 0, nullptr, 0.0f, 10.0f, {235, 40}
+    );
+    ImGui::PopStyleColor();
+    ImGui::Text("Opaque %.2f  Transparent %.2f", gpu.opaque, gpu.transparent);
+    ImGui::Text("Uploads %.2f  UI %.2f", gpu.uploads, gpu.ui);
+
     // rendered objects
     ImGui::PushStyleColor(ImGuiCol_PlotHistogram, {0.20f, 0.40f, 0.70f, 1.0f});
     ImGui::Text("Rendered objects: %.0f", impl_->rendered_objects_series.LastValue());
@@ -0,0 +1,66 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/utilities/allocation_tracker.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+auto skip_if_disabled() {
+    return !vglx::AllocationTracker::IsEnabled();
+}
+
+}
+
+#pragma region Counting
+
+TEST(AllocationTracker, CountsAllocationsAndBytes) {
+    if (skip_if_disabled()) GTEST_SKIP() << "Built without VGLX_TRACK_ALLOCATIONS";
+
+    const auto allocations = vglx::AllocationTracker::ThreadAllocations();
+    const auto bytes = vglx::AllocationTracker::ThreadAllocatedBytes();
+
+    auto value = std::make_unique<int>(1);
+    auto values = std::make_unique<int[]>(16);
+
+    EXPECT_EQ(vglx::AllocationTracker::ThreadAllocations() - allocations, 2);
+    EXPECT_EQ(vglx::AllocationTracker::ThreadAllocatedBytes() - bytes, 17 * sizeof(int));
+}
+
+TEST(AllocationTracker, CountsAlignedAllocations) {
+    if (skip_if_disabled()) GTEST_SKIP() << "Built without VGLX_TRACK_ALLOCATIONS";
+
+    struct alignas(64) Aligned { float data[16]; };
+
+    const auto allocations = vglx::AllocationTracker::ThreadAllocations();
+    auto value = std::make_unique<Aligned>();
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(value.get()) % 64, 0);
+    EXPECT_EQ(vglx::AllocationTracker::ThreadAllocations() - allocations, 1);
+}
+
+TEST(AllocationTracker, IgnoresOtherThreads) {
+    if (skip_if_disabled()) GTEST_SKIP() << "Built without VGLX_TRACK_ALLOCATIONS";
+
+    const auto allocations = vglx::AllocationTracker::ThreadAllocations();
+    auto worker = std::thread {[] {
+        auto values = std::vector<std::unique_ptr<int>> {};
+        for (auto i = 0; i < 100; ++i) values.emplace_back(std::make_unique<int>(i));
+    }};
+    worker.join();
+
+    // Starting the thread allocates its state on this thread, the work does not.
+    EXPECT_LT(vglx::AllocationTracker::ThreadAllocations() - allocations, 100);
+}
+
+#pragma endregion
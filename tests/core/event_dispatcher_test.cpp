@@ -95,6 +95,7 @@ TEST_F(EventDispatcherTest, DispatchWithExpiredListener) {
     listener.reset();
 
     vglx::EventDispatcher::Get().Dispatch(testEvent, std::make_unique<vglx::Event>());
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStdout();
 
     EXPECT_THAT(output, ::testing::HasSubstr("Removed expired"));
@@ -105,6 +106,7 @@ TEST_F(EventDispatcherTest, RemoveNonExistentListener) {
 
     auto listener = std::make_shared<vglx::EventListener>([](const vglx::Event*) {});
     vglx::EventDispatcher::Get().RemoveEventListener("NonExistentEvent", listener);
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStdout();
 
     EXPECT_THAT(output, ::testing::HasSubstr("Attempting to remove"));
@@ -0,0 +1,102 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/utilities/allocation_tracker.hpp>
+
+#include <utilities/frame_arena.hpp>
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#pragma region Linear Arena
+
+TEST(LinearArena, RespectsAlignment) {
+    auto arena = vglx::LinearArena {1024};
+
+    static_cast<void>(arena.allocate(1, 1));
+    const auto ptr = arena.allocate(16, 64);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64, 0);
+    EXPECT_FALSE(arena.Overflowed());
+}
+
+TEST(LinearArena, ResetReusesBlock) {
+    auto arena = vglx::LinearArena {1024};
+
+    const auto first = arena.allocate(256, 16);
+    arena.Reset();
+    const auto second = arena.allocate(256, 16);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(arena.Used(), 256);
+}
+
+TEST(LinearArena, GrowsToHighWaterMarkAfterOverflow) {
+    auto arena = vglx::LinearArena {64};
+
+    for (auto i = 0; i < 10; ++i) {
+        static_cast<void>(arena.allocate(32, 8));
+    }
+    EXPECT_TRUE(arena.Overflowed());
+
+    arena.Reset();
+    EXPECT_GE(arena.Capacity(), 320);
+
+    for (auto i = 0; i < 10; ++i) {
+        static_cast<void>(arena.allocate(32, 8));
+    }
+    EXPECT_FALSE(arena.Overflowed());
+}
+
+#pragma endregion
+
+#pragma region Frame Arena
+
+TEST(FrameArena, KeepsPreviousFrameAlive) {
+    auto arena = vglx::FrameArena {1024};
+
+    arena.BeginFrame();
+    const auto previous = arena.Resource();
+    auto values = std::pmr::vector<int> {{1, 2, 3}, previous};
+
+    arena.BeginFrame();
+    auto current = std::pmr::vector<int> {{4, 5, 6}, arena.Resource()};
+
+    EXPECT_NE(arena.Resource(), previous);
+    EXPECT_EQ(values, (std::pmr::vector<int> {1, 2, 3}));
+    EXPECT_EQ(arena.Previous().Used(), 3 * sizeof(int));
+
+    arena.BeginFrame();
+    EXPECT_EQ(arena.Resource(), previous);
+    EXPECT_EQ(arena.Current().Used(), 0);
+}
+
+TEST(FrameArena, SteadyStateFrameDoesNotAllocate) {
+    if (!vglx::AllocationTracker::IsEnabled()) {
+        GTEST_SKIP() << "Built without VGLX_TRACK_ALLOCATIONS";
+    }
+
+    auto arena = vglx::FrameArena {256};
+    const auto frame = [&arena] {
+        arena.BeginFrame();
+        auto values = std::pmr::vector<float> {arena.Resource()};
+        for (auto i = 0; i < 1000; ++i) values.emplace_back(static_cast<float>(i));
+    };
+
+    // Both arenas overflow once and grow to fit the frame.
+    for (auto i = 0; i < 4; ++i) frame();
+
+    const auto before = vglx::AllocationTracker::ThreadAllocations();
+    frame();
+
+    EXPECT_EQ(vglx::AllocationTracker::ThreadAllocations() - before, 0);
+}
+
+#pragma endregion
@@ -0,0 +1,63 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/core/identity.hpp>
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#pragma region Identifiers
+
+TEST(Identity, UniqueIds) {
+    auto a = vglx::Identity {};
+    auto b = vglx::Identity {};
+
+    EXPECT_NE(a.Id(), 0);
+    EXPECT_NE(a.Id(), b.Id());
+}
+
+TEST(Identity, UniqueIdsAcrossThreads) {
+    constexpr auto thread_count = 4;
+    constexpr auto ids_per_thread = 1000;
+
+    auto mutex = std::mutex {};
+    auto ids = std::set<uint64_t> {};
+    auto threads = std::vector<std::thread> {};
+
+    for (auto t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&] {
+            auto local = std::vector<uint64_t> {};
+            for (auto i = 0; i < ids_per_thread; ++i) {
+                local.emplace_back(vglx::Identity {}.Id());
+            }
+            const auto lock = std::scoped_lock(mutex);
+            ids.insert(local.begin(), local.end());
+        });
+    }
+
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(ids.size(), thread_count * ids_per_thread);
+}
+
+#pragma endregion
+
+#pragma region Names
+
+TEST(Identity, SetName) {
+    auto identity = vglx::Identity {};
+    EXPECT_TRUE(identity.Name().empty());
+
+    identity.SetName("node");
+    EXPECT_EQ(identity.Name(), "node");
+}
+
+#pragma endregion
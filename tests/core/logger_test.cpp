@@ -10,15 +10,27 @@
 
 #include <utilities/logger.hpp>
 
+#include <algorithm>
 #include <string>
 
 using namespace std::string_literals;
 
+namespace {
+
+auto count_lines(const std::string& output) {
+    return std::ranges::count(output, '\n');
+}
+
+}
+
 #pragma region Standard Logger
 
 TEST(Logger, LogInfo) {
+    if (!vglx::Logger::IsEnabled(vglx::LogLevel::Info)) GTEST_SKIP();
+
     testing::internal::CaptureStdout();
     vglx::Logger::Log(vglx::LogLevel::Info, "info");
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStdout();
 
     EXPECT_THAT(output, ::testing::HasSubstr("\x1B[1;34m[Info]\x1B[0m: info"));
@@ -27,6 +39,7 @@ TEST(Logger, LogInfo) {
 TEST(Logger, LogWarning) {
     testing::internal::CaptureStdout();
     vglx::Logger::Log(vglx::LogLevel::Warning, "warning");
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStdout();
 
     EXPECT_THAT(output, ::testing::HasSubstr("\x1B[1;33m[Warning]\x1B[0m: warning"));
@@ -35,14 +48,18 @@ TEST(Logger, LogWarning) {
 TEST(Logger, LogError) {
     testing::internal::CaptureStderr();
     vglx::Logger::Log(vglx::LogLevel::Error, "error");
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStderr();
 
     EXPECT_THAT(output, ::testing::HasSubstr("\x1B[1;31m[Error]\x1B[0m: error"));
 }
 
 TEST(Logger, LogDebug) {
+    if (!vglx::Logger::IsEnabled(vglx::LogLevel::Debug)) GTEST_SKIP();
+
     testing::internal::CaptureStdout();
     vglx::Logger::Log(vglx::LogLevel::Debug, "debug");
+    vglx::Logger::Flush();
     auto output = testing::internal::GetCapturedStdout();
 
     EXPECT_THAT(output, ::testing::HasSubstr("\x1B[1;35m[Debug]\x1B[0m: debug"));
@@ -53,10 +70,13 @@ TEST(Logger, LogDebug) {
 #pragma region String formatting
 
 TEST(Logger, StringFormatting) {
+    if (!vglx::Logger::IsEnabled(vglx::LogLevel::Info)) GTEST_SKIP();
+
     testing::internal::CaptureStdout();
 
     auto version = "OpenGL ES 3.2 NVIDIA 560.94 initialized"s;
     vglx::Logger::Log(vglx::LogLevel::Info, "version {}", version);
+    vglx::Logger::Flush();
 
     auto output = testing::internal::GetCapturedStdout();
     EXPECT_THAT(output, ::testing::HasSubstr(
@@ -64,4 +84,53 @@ TEST(Logger, StringFormatting) {
     );
 }
 
-#pragma endregion
\ No newline at end of file
+TEST(Logger, LogsLongMessagesWhole) {
+    testing::internal::CaptureStderr();
+
+    const auto message = std::string(vglx::Logger::kMaxMessageLength * 4, 'x') + "end";
+    vglx::Logger::Log(vglx::LogLevel::Error, "link failed: {}", message);
+    vglx::Logger::Flush();
+
+    auto output = testing::internal::GetCapturedStderr();
+    EXPECT_THAT(output, ::testing::HasSubstr("link failed: " + message + " -> "));
+}
+
+#pragma endregion
+
+#pragma region Rate Limiting
+
+TEST(Logger, RateLimitsEachCallSite) {
+    testing::internal::CaptureStdout();
+    for (auto i = 0; i < 100; ++i) {
+        vglx::Logger::Log(vglx::LogLevel::Warning, "repeated {}", i);
+    }
+    vglx::Logger::Flush();
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(count_lines(output), vglx::Logger::kMaxMessagesPerWindow);
+}
+
+TEST(Logger, ErrorsHaveLargerBudget) {
+    testing::internal::CaptureStderr();
+    for (auto i = 0; i < 100; ++i) {
+        vglx::Logger::Log(vglx::LogLevel::Error, "failed {}", i);
+    }
+    vglx::Logger::Flush();
+    auto output = testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ(count_lines(output), vglx::Logger::kMaxErrorsPerWindow);
+}
+
+TEST(Logger, CallSitesAreLimitedIndependently) {
+    testing::internal::CaptureStdout();
+    for (auto i = 0; i < 100; ++i) {
+        vglx::Logger::Log(vglx::LogLevel::Warning, "first");
+        vglx::Logger::Log(vglx::LogLevel::Warning, "second");
+    }
+    vglx::Logger::Flush();
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(count_lines(output), vglx::Logger::kMaxMessagesPerWindow * 2);
+}
+
+#pragma endregion
@@ -0,0 +1,148 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <vglx/utilities/profiler.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using Profiler = vglx::Profiler;
+
+#pragma region Capture
+
+TEST(Profiler, IgnoresZonesOutsideCapture) {
+    Profiler::BeginCapture();
+    Profiler::EndCapture();
+
+    { Profiler::Zone zone {"Idle"}; }
+
+    EXPECT_FALSE(Profiler::IsCapturing());
+    EXPECT_EQ(Profiler::RecordedZones(), 0);
+}
+
+TEST(Profiler, RecordsNestedZones) {
+    Profiler::BeginCapture();
+    {
+        Profiler::Zone outer {"Outer"};
+        Profiler::Zone inner {"Inner"};
+    }
+    Profiler::EndCapture();
+
+    EXPECT_EQ(Profiler::RecordedZones(), 2);
+}
+
+TEST(Profiler, BeginCaptureDiscardsPreviousCapture) {
+    Profiler::BeginCapture();
+    { Profiler::Zone zone {"First"}; }
+    Profiler::BeginCapture();
+    { Profiler::Zone zone {"Second"}; }
+    Profiler::EndCapture();
+
+    EXPECT_EQ(Profiler::RecordedZones(), 1);
+    EXPECT_THAT(Profiler::ToChromeTrace(), ::testing::Not(::testing::HasSubstr("First")));
+}
+
+TEST(Profiler, RecordsZonesFromMultipleThreads) {
+    Profiler::BeginCapture();
+
+    auto threads = std::vector<std::thread> {};
+    for (auto i = 0; i < 4; ++i) {
+        threads.emplace_back([] {
+            for (auto j = 0; j < 100; ++j) {
+                Profiler::Zone zone {"Worker"};
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    Profiler::EndCapture();
+
+    EXPECT_EQ(Profiler::RecordedZones(), 400);
+    EXPECT_EQ(Profiler::DroppedZones(), 0);
+}
+
+TEST(Profiler, ReusesBuffersOfExitedThreads) {
+    Profiler::BeginCapture();
+    std::thread([] { Profiler::Zone zone {"Warmup"}; }).join();
+    const auto allocated = Profiler::AllocatedBuffers();
+
+    for (auto i = 0; i < 8; ++i) {
+        std::thread([] { Profiler::Zone zone {"Worker"}; }).join();
+    }
+    Profiler::EndCapture();
+
+    EXPECT_EQ(Profiler::AllocatedBuffers(), allocated);
+    EXPECT_EQ(Profiler::RecordedZones(), 9);
+    EXPECT_THAT(Profiler::ToChromeTrace(), ::testing::HasSubstr("Worker"));
+}
+
+TEST(Profiler, DropsZonesBeyondCapacity) {
+    Profiler::BeginCapture();
+    for (auto i = std::size_t {0}; i < Profiler::kMaxZonesPerThread + 10; ++i) {
+        Profiler::Zone zone {"Zone"};
+    }
+    Profiler::EndCapture();
+
+    EXPECT_EQ(Profiler::RecordedZones(), Profiler::kMaxZonesPerThread);
+    EXPECT_EQ(Profiler::DroppedZones(), 10);
+}
+
+#pragma endregion
+
+#pragma region Chrome Trace
+
+TEST(Profiler, ChromeTraceContainsCompleteEvents) {
+    Profiler::BeginCapture();
+    { Profiler::Zone zone {"Renderer::Render"}; }
+    Profiler::EndCapture();
+
+    const auto trace = Profiler::ToChromeTrace();
+
+    EXPECT_THAT(trace, ::testing::StartsWith("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_THAT(trace, ::testing::HasSubstr("\"name\":\"Renderer::Render\""));
+    EXPECT_THAT(trace, ::testing::HasSubstr("\"ph\":\"X\""));
+    EXPECT_THAT(trace, ::testing::HasSubstr("\"ph\":\"M\""));
+}
+
+TEST(Profiler, ChromeTraceEscapesNames) {
+    Profiler::BeginCapture();
+    { Profiler::Zone zone {"Load \"mesh\\1\""}; }
+    Profiler::EndCapture();
+
+    EXPECT_THAT(Profiler::ToChromeTrace(), ::testing::HasSubstr("\"name\":\"Load \\\"mesh\\\\1\\\"\""));
+}
+
+TEST(Profiler, WriteChromeTrace) {
+    Profiler::BeginCapture();
+    { Profiler::Zone zone {"Frame"}; }
+    Profiler::EndCapture();
+
+    const auto path = std::filesystem::temp_directory_path() / "vglx_profiler_test.json";
+    const auto result = Profiler::WriteChromeTrace(path);
+    ASSERT_TRUE(result);
+
+    auto file = std::ifstream {path};
+    auto contents = std::stringstream {};
+    contents << file.rdbuf();
+
+    EXPECT_EQ(contents.str(), Profiler::ToChromeTrace());
+    std::filesystem::remove(path);
+}
+
+TEST(Profiler, WriteChromeTraceFailsOnInvalidPath) {
+    const auto result = Profiler::WriteChromeTrace("missing_dir/trace.json");
+
+    EXPECT_FALSE(result);
+}
+
+#pragma endregion
@@ -0,0 +1,303 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <test_helpers.hpp>
+
+#include <vglx/cameras/perspective_camera.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/lights/directional_light.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/math/utilities.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <core/render_lists.hpp>
+
+#include <memory>
+
+namespace {
+
+auto make_camera() {
+    return vglx::PerspectiveCamera::Create({
+        .fov = vglx::math::DegToRad(60.0f),
+        .aspect = 1.0f,
+        .near = 0.1f,
+        .far = 100.0f
+    });
+}
+
+auto make_mesh(float z, bool transparent = false) {
+    auto material = vglx::UnlitMaterial::Create();
+    material->transparent = transparent;
+    auto mesh = vglx::Mesh::Create(vglx::BoxGeometry::Create(), material);
+    mesh->transform.SetPosition({0.0f, 0.0f, z});
+    return mesh;
+}
+
+auto process(vglx::RenderLists& lists, vglx::Scene* scene, vglx::Camera* camera) {
+    scene->UpdateTransformHierarchy();
+    camera->UpdateViewMatrix();
+    lists.ProcessScene(scene, camera);
+}
+
+}
+
+#pragma region Sorting
+
+TEST(RenderLists, SortsOpaqueFrontToBack) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto far = make_mesh(-20.0f);
+    auto near = make_mesh(-5.0f);
+    scene->Add(far);
+    scene->Add(near);
+
+    auto lists = vglx::RenderLists {};
+    process(lists, scene.get(), camera.get());
+
+    ASSERT_EQ(lists.Opaque().size(), 2);
+    EXPECT_EQ(lists.Opaque()[0].renderable, near.get());
+    EXPECT_EQ(lists.Opaque()[1].renderable, far.get());
+    EXPECT_FLOAT_EQ(lists.Opaque()[0].depth, 5.0f);
+    EXPECT_FLOAT_EQ(lists.Opaque()[1].depth, 20.0f);
+}
+
+TEST(RenderLists, SortsTransparentBackToFront) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto near = make_mesh(-5.0f, true);
+    auto far = make_mesh(-20.0f, true);
+    scene->Add(near);
+    scene->Add(far);
+
+    auto lists = vglx::RenderLists {};
+    process(lists, scene.get(), camera.get());
+
+    EXPECT_TRUE(lists.Opaque().empty());
+    ASSERT_EQ(lists.Transparent().size(), 2);
+    EXPECT_EQ(lists.Transparent()[0].renderable, far.get());
+    EXPECT_EQ(lists.Transparent()[1].renderable, near.get());
+}
+
+#pragma endregion
+
+#pragma region World Data
+
+TEST(RenderLists, CapturesWorldData) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto parent = vglx::Node::Create();
+    auto mesh = make_mesh(-2.0f);
+    parent->transform.SetPosition({1.0f, 0.0f, -8.0f});
+    parent->Add(mesh);
+    scene->Add(parent);
+
+    auto lists = vglx::RenderLists {};
+    process(lists, scene.get(), camera.get());
+
+    ASSERT_EQ(lists.Opaque().size(), 1);
+    const auto& item = lists.Opaque()[0];
+    EXPECT_MAT4_EQ(item.world_transform, mesh->GetWorldTransform());
+    EXPECT_VEC3_NEAR(item.bounding_sphere.center, {1.0f, 0.0f, -10.0f}, 1e-5f);
+    EXPECT_FLOAT_EQ(item.depth, 10.0f);
+}
+
+#pragma endregion
+
+#pragma region Culling
+
+TEST(RenderLists, CullsObjectsOutsideFrustum) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto behind = make_mesh(10.0f);
+    scene->Add(make_mesh(-5.0f));
+    scene->Add(behind);
+
+    auto lists = vglx::RenderLists {};
+    process(lists, scene.get(), camera.get());
+    EXPECT_EQ(lists.Opaque().size(), 1);
+    EXPECT_EQ(lists.Culled(), 1);
+
+    behind->frustum_culled = false;
+    process(lists, scene.get(), camera.get());
+    EXPECT_EQ(lists.Opaque().size(), 2);
+    EXPECT_EQ(lists.Culled(), 0);
+}
+
+TEST(RenderLists, CullingHintsFollowObjectsAcrossFrames) {
+    for (auto incremental : {false, true}) {
+        auto scene = vglx::Scene::Create();
+        auto camera = make_camera();
+        auto lists = vglx::RenderLists {incremental};
+        process(lists, scene.get(), camera.get());
+
+        auto left = make_mesh(-5.0f);
+        auto behind = make_mesh(10.0f);
+        left->transform.SetPosition({-50.0f, 0.0f, -5.0f});
+        scene->Add(left);
+        scene->Add(behind);
+        process(lists, scene.get(), camera.get());
+        EXPECT_EQ(lists.Culled(), 2);
+
+        // The planes that rejected each mesh are tested first now, and must
+        // not hide them once they move into view
+        left->transform.SetPosition({0.0f, 0.0f, -5.0f});
+        process(lists, scene.get(), camera.get());
+        ASSERT_EQ(lists.Opaque().size(), 1);
+        EXPECT_EQ(lists.Opaque()[0].renderable, left.get());
+
+        behind->transform.SetPosition({0.0f, 0.0f, -8.0f});
+        process(lists, scene.get(), camera.get());
+        EXPECT_EQ(lists.Opaque().size(), 2);
+        EXPECT_EQ(lists.Culled(), 0);
+    }
+}
+
+TEST(RenderLists, SkipsInvisibleMaterials) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto mesh = make_mesh(-5.0f);
+    mesh->GetMaterial()->visible = false;
+    scene->Add(mesh);
+
+    auto lists = vglx::RenderLists {};
+    process(lists, scene.get(), camera.get());
+
+    EXPECT_TRUE(lists.Opaque().empty());
+}
+
+#pragma endregion
+
+#pragma region Incremental Mode
+
+TEST(RenderLists, IncrementalMatchesFullRebuild) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    for (auto i = 0; i < 16; ++i) {
+        scene->Add(make_mesh(-2.0f - static_cast<float>((i * 7) % 16), i % 3 == 0));
+    }
+
+    auto full = vglx::RenderLists {};
+    auto incremental = vglx::RenderLists {true};
+    process(full, scene.get(), camera.get());
+    process(incremental, scene.get(), camera.get());
+
+    ASSERT_EQ(full.Opaque().size(), incremental.Opaque().size());
+    ASSERT_EQ(full.Transparent().size(), incremental.Transparent().size());
+    for (auto i = 0; i < full.Opaque().size(); ++i) {
+        EXPECT_FLOAT_EQ(full.Opaque()[i].depth, incremental.Opaque()[i].depth);
+    }
+    for (auto i = 0; i < full.Transparent().size(); ++i) {
+        EXPECT_FLOAT_EQ(full.Transparent()[i].depth, incremental.Transparent()[i].depth);
+    }
+}
+
+TEST(RenderLists, IncrementalTracksSceneChanges) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto lists = vglx::RenderLists {true};
+    auto mesh1 = make_mesh(-5.0f);
+    scene->Add(mesh1);
+
+    process(lists, scene.get(), camera.get());
+    EXPECT_EQ(lists.Opaque().size(), 1);
+
+    auto group = vglx::Node::Create();
+    auto mesh2 = make_mesh(-10.0f);
+    auto mesh3 = make_mesh(-3.0f);
+    group->Add(mesh2);
+    group->Add(mesh3);
+    scene->Add(group);
+
+    process(lists, scene.get(), camera.get());
+    ASSERT_EQ(lists.Opaque().size(), 3);
+    EXPECT_EQ(lists.Opaque()[0].renderable, mesh3.get());
+    EXPECT_EQ(lists.Opaque()[1].renderable, mesh1.get());
+    EXPECT_EQ(lists.Opaque()[2].renderable, mesh2.get());
+
+    scene->Remove(group);
+    process(lists, scene.get(), camera.get());
+    ASSERT_EQ(lists.Opaque().size(), 1);
+    EXPECT_EQ(lists.Opaque()[0].renderable, mesh1.get());
+}
+
+TEST(RenderLists, IncrementalIgnoresNodesOutsideScene) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto lists = vglx::RenderLists {true};
+    process(lists, scene.get(), camera.get());
+
+    auto detached = vglx::Node::Create();
+    detached->Add(make_mesh(-5.0f));
+
+    process(lists, scene.get(), camera.get());
+    EXPECT_TRUE(lists.Opaque().empty());
+}
+
+TEST(RenderLists, IncrementalReaddedNodeIsListedOnce) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto lists = vglx::RenderLists {true};
+    auto mesh = make_mesh(-5.0f);
+    scene->Add(mesh);
+    process(lists, scene.get(), camera.get());
+
+    scene->Remove(mesh);
+    scene->Add(mesh);
+    process(lists, scene.get(), camera.get());
+
+    EXPECT_EQ(lists.Opaque().size(), 1);
+}
+
+TEST(RenderLists, IncrementalDropsDestroyedNodes) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto lists = vglx::RenderLists {true};
+    process(lists, scene.get(), camera.get());
+
+    auto mesh = make_mesh(-5.0f);
+    auto light = vglx::DirectionalLight::Create({.color = 0xFFFFFF, .intensity = 1.0f});
+    scene->Add(mesh);
+    scene->Add(light);
+    process(lists, scene.get(), camera.get());
+    EXPECT_EQ(lists.Lights().size(), 1);
+
+    // The replacement may be allocated at the address of the destroyed mesh
+    scene->Remove(mesh);
+    scene->Remove(light);
+    mesh.reset();
+    light.reset();
+    auto replacement = make_mesh(-6.0f);
+    scene->Add(replacement);
+    EXPECT_TRUE(lists.Lights().empty());
+
+    process(lists, scene.get(), camera.get());
+    ASSERT_EQ(lists.Opaque().size(), 1);
+    EXPECT_EQ(lists.Opaque()[0].renderable, replacement.get());
+}
+
+TEST(RenderLists, IncrementalResortsAfterMovement) {
+    auto scene = vglx::Scene::Create();
+    auto camera = make_camera();
+    auto lists = vglx::RenderLists {true};
+    auto mesh1 = make_mesh(-5.0f);
+    auto mesh2 = make_mesh(-10.0f);
+    scene->Add(mesh1);
+    scene->Add(mesh2);
+    process(lists, scene.get(), camera.get());
+    EXPECT_EQ(lists.Opaque()[0].renderable, mesh1.get());
+
+    mesh1->transform.SetPosition({0.0f, 0.0f, -15.0f});
+    process(lists, scene.get(), camera.get());
+
+    ASSERT_EQ(lists.Opaque().size(), 2);
+    EXPECT_EQ(lists.Opaque()[0].renderable, mesh2.get());
+    EXPECT_EQ(lists.Opaque()[1].renderable, mesh1.get());
+}
+
+#pragma endregion
@@ -0,0 +1,581 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <gl_recorder.hpp>
+
+#include <vglx/cameras/perspective_camera.hpp>
+#include <vglx/core/renderer.hpp>
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/geometries/sphere_geometry.hpp>
+#include <vglx/lights/ambient_light.hpp>
+#include <vglx/lights/directional_light.hpp>
+#include <vglx/lights/point_light.hpp>
+#include <vglx/materials/phong_material.hpp>
+#include <vglx/materials/shader_material.hpp>
+#include <vglx/materials/unlit_material.hpp>
+#include <vglx/math/utilities.hpp>
+#include <vglx/nodes/instanced_mesh.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+#include <vglx/textures/texture_2d.hpp>
+#include <vglx/utilities/allocation_tracker.hpp>
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string_view>
+
+namespace {
+
+auto make_camera() {
+    return vglx::PerspectiveCamera::Create({
+        .fov = vglx::math::DegToRad(60.0f),
+        .aspect = 1.0f,
+        .near = 0.1f,
+        .far = 100.0f
+    });
+}
+
+auto make_renderer(
+    const std::filesystem::path& program_cache_directory = {},
+    bool dynamic_light_count = false
+) {
+    return vglx::Renderer {{
+        .framebuffer_width = 800,
+        .framebuffer_height = 800,
+        .clear_color = 0x000000,
+        .program_cache_directory = program_cache_directory,
+        .dynamic_light_count = dynamic_light_count
+    }};
+}
+
+auto make_cache_directory(std::string_view name) {
+    const auto directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(directory);
+    return directory;
+}
+
+auto add_mesh(
+    vglx::Scene* scene,
+    std::shared_ptr<vglx::Geometry> geometry,
+    std::shared_ptr<vglx::Material> material,
+    float z
+) {
+    auto mesh = vglx::Mesh::Create(geometry, material);
+    mesh->transform.SetPosition({0.0f, 0.0f, z});
+    scene->Add(mesh);
+    return mesh;
+}
+
+auto make_cached_scene() {
+    auto scene = vglx::Scene::Create();
+    add_mesh(scene.get(), vglx::BoxGeometry::Create(), vglx::UnlitMaterial::Create(), -5.0f);
+    return scene;
+}
+
+}
+
+#pragma region Fixtures
+
+class RendererTest : public ::testing::Test {
+protected:
+    auto AddMesh(float z) {
+        return add_mesh(scene.get(), geometry, material, z);
+    }
+
+    auto AddMesh(std::shared_ptr<vglx::Material> other, float z) {
+        return add_mesh(scene.get(), geometry, other, z);
+    }
+
+    auto Render() {
+        renderer.Render(scene.get(), camera.get());
+    }
+
+    // Installed first so the renderer only ever sees the recorded GL calls
+    GLRecorder recorder {};
+    vglx::Renderer renderer {make_renderer()};
+    std::shared_ptr<vglx::Scene> scene {vglx::Scene::Create()};
+    std::shared_ptr<vglx::PerspectiveCamera> camera {make_camera()};
+    std::shared_ptr<vglx::BoxGeometry> geometry {vglx::BoxGeometry::Create()};
+    std::shared_ptr<vglx::UnlitMaterial> material {vglx::UnlitMaterial::Create()};
+};
+
+#pragma endregion
+
+#pragma region Uploads
+
+TEST_F(RendererTest, UploadsSharedGeometryOnce) {
+    for (auto i = 0; i < 3; ++i) {
+        AddMesh(-5.0f - i);
+    }
+
+    recorder.Reset();
+    Render();
+    const auto& counts = recorder.GetCounts();
+
+    // One vertex buffer and one index buffer
+    EXPECT_EQ(counts.buffer_data, 2);
+    EXPECT_EQ(counts.link_program, 1);
+    EXPECT_EQ(counts.draw_elements, 3);
+}
+
+#pragma endregion
+
+#pragma region State Changes
+
+TEST_F(RendererTest, SharedMaterialBindsProgramOnce) {
+    for (auto i = 0; i < 3; ++i) {
+        AddMesh(-5.0f - i);
+    }
+
+    recorder.Reset();
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().use_program, 1);
+    EXPECT_EQ(renderer.GetFrameStats().program_binds, 1);
+}
+
+TEST_F(RendererTest, SteadyStateFrameSkipsRedundantBinds) {
+    for (auto i = 0; i < 3; ++i) {
+        AddMesh(-5.0f - i);
+    }
+
+    Render();
+    recorder.Reset();
+    Render();
+    const auto& counts = recorder.GetCounts();
+
+    EXPECT_EQ(counts.use_program, 0);
+    EXPECT_EQ(counts.bind_vertex_array, 0);
+    EXPECT_EQ(counts.buffer_data, 0);
+    EXPECT_EQ(counts.link_program, 0);
+    EXPECT_EQ(counts.DrawCalls(), 3);
+}
+
+TEST_F(RendererTest, DrawsBindPerObjectUniformBlocks) {
+    material->color = 0xFF0000;
+    material->opacity = 0.5f;
+    AddMesh(-5.0f);
+    AddMesh(-6.0f);
+
+    Render();
+    const auto& counts = recorder.GetCounts();
+
+    EXPECT_EQ(counts.bind_buffer_range, 2);
+    EXPECT_EQ(counts.uniform, 0);
+
+    // Blocks are 256 bytes apart and follow the std140 ub_Object layout
+    const auto& bytes = recorder.GetMappedBytes();
+    ASSERT_EQ(bytes.size(), 512);
+    auto block = std::array<float, 40> {};
+    std::memcpy(block.data(), bytes.data(), sizeof(block));
+    EXPECT_FLOAT_EQ(block[14], -5.0f); // model translation z
+    EXPECT_FLOAT_EQ(block[28], 1.0f); // color r
+    EXPECT_FLOAT_EQ(block[29], 0.0f); // color g
+    EXPECT_FLOAT_EQ(block[31], 0.5f); // opacity
+    EXPECT_EQ(renderer.GetFrameStats().object_uniform_writes, 2);
+}
+
+TEST_F(RendererTest, ObjectBlockTakesTransformOfLastBoundMap) {
+    const auto make_texture = [](float offset) {
+        auto texture = vglx::Texture2D::Create({.width = 1, .height = 1, .data = {0xFF, 0xFF, 0xFF, 0xFF}});
+        texture->OffsetX(offset);
+        return texture;
+    };
+    material->texture_map = make_texture(0.25f);
+    material->alpha_map = make_texture(0.5f);
+    AddMesh(-5.0f);
+
+    Render();
+
+    // The alpha map is bound after the texture map
+    const auto expected = material->alpha_map->GetTransform();
+    auto block = std::array<float, 40> {};
+    std::memcpy(block.data(), recorder.GetMappedBytes().data(), sizeof(block));
+    EXPECT_FLOAT_EQ(block[24], expected[2].x); // texture transform translation x
+    EXPECT_NE(block[24], material->texture_map->GetTransform()[2].x);
+}
+
+TEST_F(RendererTest, ProgramsWithoutObjectBlockGetPerObjectUniforms) {
+    recorder.SetActiveUniforms({{"u_Model", GL_FLOAT_MAT4}, {"u_Opacity", GL_FLOAT}});
+    AddMesh(vglx::ShaderMaterial::Create({
+        .vertex_shader = "#version 410 core\n#pragma inject_attributes\nuniform mat4 u_Model;\n",
+        .fragment_shader = "#version 410 core\n#pragma inject_attributes\nuniform float u_Opacity;\n"
+    }), -5.0f);
+
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().uniform, 2);
+}
+
+TEST_F(RendererTest, ProgramsWithObjectBlockSkipPerObjectUniforms) {
+    recorder.SetActiveUniformBlocks({"ub_Object"});
+    recorder.SetActiveUniforms({{"u_Model", GL_FLOAT_MAT4}, {"u_Opacity", GL_FLOAT}});
+    AddMesh(-5.0f);
+
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().uniform, 0);
+    EXPECT_EQ(recorder.GetCounts().bind_buffer_range, 1);
+}
+
+TEST_F(RendererTest, SkipsObjectBlockDrawsWhenRingMapFails) {
+    recorder.SetActiveUniformBlocks({"ub_Object"});
+    recorder.SetMapBufferFails(true);
+    AddMesh(-5.0f);
+
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().bind_buffer_range, 0);
+    EXPECT_EQ(recorder.GetCounts().DrawCalls(), 0);
+
+    recorder.SetMapBufferFails(false);
+    recorder.Reset();
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().bind_buffer_range, 1);
+    EXPECT_EQ(recorder.GetCounts().DrawCalls(), 1);
+}
+
+TEST_F(RendererTest, BindsEachVertexArrayOncePerFrame) {
+    AddMesh(-5.0f);
+    add_mesh(scene.get(), vglx::SphereGeometry::Create(), material, -8.0f);
+
+    Render();
+    recorder.Reset();
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().bind_vertex_array, 2);
+    EXPECT_EQ(recorder.GetCounts().draw_elements, 2);
+}
+
+#pragma endregion
+
+#pragma region Draw Calls
+
+TEST_F(RendererTest, CulledObjectsAreNotDrawn) {
+    AddMesh(-5.0f);
+    AddMesh(5.0f);
+
+    recorder.Reset();
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().DrawCalls(), 1);
+    EXPECT_EQ(renderer.GetFrameStats().culled_objects, 1);
+}
+
+TEST_F(RendererTest, InstancedMeshIssuesSingleDraw) {
+    auto mesh = vglx::InstancedMesh::Create(geometry, material, 100);
+    mesh->transform.SetPosition({0.0f, 0.0f, -5.0f});
+    scene->Add(mesh);
+
+    recorder.Reset();
+    Render();
+    const auto& counts = recorder.GetCounts();
+
+    EXPECT_EQ(counts.draw_elements_instanced, 1);
+    EXPECT_EQ(counts.DrawCalls(), 1);
+    EXPECT_EQ(renderer.GetFrameStats().instances, 100);
+}
+
+#pragma endregion
+
+#pragma region GPU Timings
+
+TEST_F(RendererTest, UploadsDoNotStarveGPUPhaseTimings) {
+    // Each geometry is uploaded in its own timed interval during the opaque pass
+    for (auto i = 0; i < 100; ++i) {
+        add_mesh(scene.get(), vglx::BoxGeometry::Create(), material, -5.0f);
+    }
+    auto transparent = vglx::UnlitMaterial::Create(0xFFFFFF);
+    transparent->transparent = true;
+    AddMesh(transparent, -6.0f);
+
+    // Results are read once the first frame's queries come around again
+    for (auto i = 0; i < 4; ++i) {
+        Render();
+    }
+    const auto timings = renderer.GetGPUTimings();
+
+    EXPECT_TRUE(timings.available);
+    EXPECT_GT(timings.transparent, 0.0);
+    EXPECT_GT(timings.uploads, 0.0);
+    EXPECT_GT(timings.dropped_intervals, 0);
+}
+
+#pragma endregion
+
+#pragma region Program Cache
+
+TEST_F(RendererTest, ProgramCacheSkipsLinkOnNextRun) {
+    const auto directory = make_cache_directory("vglx_program_cache_test");
+
+    {
+        // Renderers dispose the geometry they uploaded, so each run gets its own scene.
+        auto cached_scene = make_cached_scene();
+        auto cached_renderer = make_renderer(directory);
+        cached_renderer.Render(cached_scene.get(), camera.get());
+        EXPECT_EQ(recorder.GetCounts().link_program, 1);
+        EXPECT_EQ(cached_renderer.GetFrameStats().program_binary_loads, 0);
+    }
+
+    recorder.Reset();
+    auto cached_scene = make_cached_scene();
+    auto cached_renderer = make_renderer(directory);
+    cached_renderer.Render(cached_scene.get(), camera.get());
+    const auto& counts = recorder.GetCounts();
+
+    EXPECT_EQ(counts.link_program, 0);
+    EXPECT_EQ(counts.compile_shader, 0);
+    EXPECT_EQ(counts.program_binary, 1);
+    EXPECT_EQ(counts.DrawCalls(), 1);
+    EXPECT_EQ(cached_renderer.GetFrameStats().program_binary_loads, 1);
+    EXPECT_EQ(cached_renderer.GetFrameStats().shader_compilations, 0);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(RendererTest, ProgramCacheIgnoresCorruptEntries) {
+    const auto directory = make_cache_directory("vglx_program_cache_corrupt_test");
+
+    {
+        auto cached_scene = make_cached_scene();
+        auto cached_renderer = make_renderer(directory);
+        cached_renderer.Render(cached_scene.get(), camera.get());
+    }
+    for (const auto& entry : std::filesystem::directory_iterator {directory}) {
+        std::ofstream {entry.path(), std::ios::trunc} << "corrupt";
+    }
+
+    recorder.Reset();
+    auto cached_scene = make_cached_scene();
+    auto cached_renderer = make_renderer(directory);
+    cached_renderer.Render(cached_scene.get(), camera.get());
+
+    EXPECT_EQ(recorder.GetCounts().program_binary, 0);
+    EXPECT_EQ(recorder.GetCounts().link_program, 1);
+    EXPECT_EQ(cached_renderer.GetFrameStats().shader_compilations, 1);
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(RendererTest, ProgramCacheIgnoresEntriesWithInvalidLength) {
+    const auto directory = make_cache_directory("vglx_program_cache_length_test");
+
+    {
+        auto cached_scene = make_cached_scene();
+        auto cached_renderer = make_renderer(directory);
+        cached_renderer.Render(cached_scene.get(), camera.get());
+    }
+
+    // Claim a binary far larger than the file. The length is the last field
+    // of the entry header.
+    constexpr auto kLengthOffset = std::streamoff {36};
+    const auto length = uint32_t {1} << 28;
+    for (const auto& entry : std::filesystem::directory_iterator {directory}) {
+        auto file = std::fstream {entry.path(), std::ios::in | std::ios::out | std::ios::binary};
+        file.seekp(kLengthOffset);
+        file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    }
+
+    recorder.Reset();
+    auto cached_scene = make_cached_scene();
+    auto cached_renderer = make_renderer(directory);
+    const auto before = vglx::AllocationTracker::ThreadAllocatedBytes();
+    cached_renderer.Render(cached_scene.get(), camera.get());
+
+    EXPECT_EQ(recorder.GetCounts().program_binary, 0);
+    EXPECT_EQ(recorder.GetCounts().link_program, 1);
+    if (vglx::AllocationTracker::IsEnabled()) {
+        EXPECT_LT(vglx::AllocationTracker::ThreadAllocatedBytes() - before, length);
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_F(RendererTest, ProgramCacheRebuildsRejectedBinaries) {
+    const auto directory = make_cache_directory("vglx_program_cache_rejected_test");
+    const auto run = [&] {
+        auto cached_scene = make_cached_scene();
+        auto cached_renderer = make_renderer(directory);
+        cached_renderer.Render(cached_scene.get(), camera.get());
+        return cached_renderer.GetFrameStats();
+    };
+
+    run();
+
+    // The driver no longer accepts the stored binary
+    recorder.SetProgramBinaryAccepted(false);
+    recorder.Reset();
+    auto stats = run();
+
+    EXPECT_EQ(recorder.GetCounts().program_binary, 1);
+    EXPECT_EQ(recorder.GetCounts().link_program, 1);
+    EXPECT_EQ(recorder.GetCounts().DrawCalls(), 1);
+    EXPECT_EQ(stats.program_binary_loads, 0);
+    EXPECT_EQ(stats.shader_compilations, 1);
+
+    // The rebuilt program replaced the rejected entry
+    recorder.SetProgramBinaryAccepted(true);
+    recorder.Reset();
+    stats = run();
+
+    EXPECT_EQ(recorder.GetCounts().link_program, 0);
+    EXPECT_EQ(stats.program_binary_loads, 1);
+
+    std::filesystem::remove_all(directory);
+}
+
+#pragma endregion
+
+#pragma region Parallel Compilation
+
+TEST_F(RendererTest, PendingProgramSkipsObjectUntilReady) {
+    recorder.SetParallelShaderCompile(true);
+    recorder.SetCompilationComplete(false);
+    renderer = make_renderer();
+    AddMesh(-5.0f);
+
+    Render();
+    EXPECT_EQ(recorder.GetCounts().DrawCalls(), 0);
+    EXPECT_EQ(renderer.GetFrameStats().pending_objects, 1);
+
+    recorder.SetCompilationComplete(true);
+    recorder.Reset();
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().DrawCalls(), 1);
+    EXPECT_EQ(recorder.GetCounts().link_program, 0);
+    EXPECT_EQ(renderer.GetFrameStats().pending_objects, 0);
+}
+
+TEST_F(RendererTest, CompileStartsProgramsForWholeScene) {
+    recorder.SetParallelShaderCompile(true);
+    recorder.SetCompilationComplete(false);
+    renderer = make_renderer();
+    AddMesh(-5.0f);
+    AddMesh(vglx::PhongMaterial::Create(0x049EF4), -6.0f);
+    // Outside the frustum, but still compiled ahead of time
+    auto hidden = vglx::UnlitMaterial::Create();
+    hidden->flat_shaded = true;
+    AddMesh(hidden, 5.0f);
+
+    renderer.Compile(scene.get(), camera.get());
+    EXPECT_EQ(recorder.GetCounts().link_program, 3);
+    EXPECT_EQ(renderer.PendingPrograms(), 3);
+
+    recorder.SetCompilationComplete(true);
+    EXPECT_EQ(renderer.PendingPrograms(), 0);
+
+    recorder.Reset();
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().link_program, 0);
+    EXPECT_EQ(recorder.GetCounts().DrawCalls(), 2);
+}
+
+TEST_F(RendererTest, CompileBlocksWithoutParallelSupport) {
+    AddMesh(-5.0f);
+
+    renderer.Compile(scene.get(), camera.get());
+
+    EXPECT_EQ(recorder.GetCounts().link_program, 1);
+    EXPECT_EQ(renderer.PendingPrograms(), 0);
+}
+
+TEST_F(RendererTest, FrameStatsCountCompileTowardNextFrame) {
+    AddMesh(-5.0f);
+
+    renderer.Compile(scene.get(), camera.get());
+    Render();
+    EXPECT_EQ(renderer.GetFrameStats().shader_compilations, 1);
+    EXPECT_EQ(renderer.GetFrameStats().draw_calls, 1);
+
+    Render();
+    EXPECT_EQ(renderer.GetFrameStats().shader_compilations, 0);
+}
+
+TEST_F(RendererTest, LightCountChangeRelinksPhongProgram) {
+    AddMesh(vglx::PhongMaterial::Create(0x049EF4), -5.0f);
+    scene->Add(vglx::DirectionalLight::Create({.color = 0xFFFFFF, .intensity = 1.0f}));
+
+    Render();
+    recorder.Reset();
+    scene->Add(vglx::PointLight::Create({.color = 0xFFFFFF, .intensity = 1.0f}));
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().link_program, 1);
+}
+
+TEST_F(RendererTest, DynamicLightCountSharesPhongProgram) {
+    renderer = make_renderer({}, true);
+    AddMesh(vglx::PhongMaterial::Create(0x049EF4), -5.0f);
+
+    Render();
+    EXPECT_EQ(recorder.GetCounts().link_program, 1);
+
+    recorder.Reset();
+    scene->Add(vglx::DirectionalLight::Create({.color = 0xFFFFFF, .intensity = 1.0f}));
+    scene->Add(vglx::PointLight::Create({.color = 0xFFFFFF, .intensity = 1.0f}));
+    Render();
+
+    EXPECT_EQ(recorder.GetCounts().link_program, 0);
+    EXPECT_EQ(recorder.GetCounts().DrawCalls(), 1);
+}
+
+#pragma endregion
+
+#pragma region Recorder
+
+TEST(Renderer, RecorderRestoresFunctionPointers) {
+    const auto original = glad_glUseProgram;
+    {
+        auto recorder = GLRecorder {};
+        EXPECT_NE(glad_glUseProgram, original);
+    }
+
+    EXPECT_EQ(glad_glUseProgram, original);
+}
+
+#pragma endregion
+
+#pragma region Allocations
+
+TEST_F(RendererTest, SteadyStateFrameDoesNotAllocate) {
+    if (!vglx::AllocationTracker::IsEnabled()) {
+        GTEST_SKIP() << "Built without VGLX_TRACK_ALLOCATIONS";
+    }
+
+    auto phong = vglx::PhongMaterial::Create(0x049EF4);
+    for (auto i = 0; i < 8; ++i) {
+        AddMesh(phong, -5.0f - i);
+    }
+    AddMesh(phong, 5.0f);
+    material->transparent = true;
+    for (auto i = 0; i < 4; ++i) {
+        AddMesh(-6.0f - i);
+    }
+    scene->Add(vglx::AmbientLight::Create({.color = 0xFFFFFF, .intensity = 0.3f}));
+    scene->Add(vglx::DirectionalLight::Create({.color = 0xFFFFFF, .intensity = 1.0f}));
+    scene->Add(vglx::PointLight::Create({.color = 0xFFFFFF, .intensity = 1.0f}));
+
+    for (auto i = 0; i < 3; ++i) {
+        scene->Advance(1.0f / 60.0f);
+        Render();
+    }
+
+    const auto before = vglx::AllocationTracker::ThreadAllocations();
+    scene->Advance(1.0f / 60.0f);
+    Render();
+
+    EXPECT_EQ(vglx::AllocationTracker::ThreadAllocations() - before, 0);
+}
+
+#pragma endregion
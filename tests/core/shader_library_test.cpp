@@ -0,0 +1,73 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+
+#include <vglx/geometries/box_geometry.hpp>
+#include <vglx/materials/phong_material.hpp>
+#include <vglx/materials/shader_material.hpp>
+#include <vglx/nodes/mesh.hpp>
+#include <vglx/nodes/scene.hpp>
+
+#include <core/program_attributes.hpp>
+#include <core/shader_library.hpp>
+
+#include <memory>
+
+namespace {
+
+auto make_attributes(
+    std::shared_ptr<vglx::Material> material,
+    const vglx::ProgramAttributes::LightsCounter& lights = {}
+) {
+    auto scene = vglx::Scene::Create();
+    auto mesh = vglx::Mesh::Create(vglx::BoxGeometry::Create(), material);
+    return vglx::ProgramAttributes {mesh.get(), lights, scene.get()};
+}
+
+}
+
+#pragma region Built-in Shaders
+
+TEST(ShaderLibrary, BuiltInShadersArriveWithIncludesExpanded) {
+    auto material = vglx::PhongMaterial::Create(0x049EF4);
+    material->flat_shaded = true;
+    const auto attrs = make_attributes(material, {.directional = 2});
+
+    const auto shaders = vglx::ShaderLibrary {}.GetShaderSource(attrs);
+
+    ASSERT_EQ(shaders.size(), 2);
+    for (const auto& shader : shaders) {
+        EXPECT_EQ(shader.source.find("#include"), std::string::npos);
+        EXPECT_EQ(shader.source.find("#pragma inject_attributes"), std::string::npos);
+        EXPECT_NE(shader.source.find("#define USE_FLAT_SHADED\n"), std::string::npos);
+        EXPECT_NE(shader.source.find("#define NUM_LIGHTS 2\n"), std::string::npos);
+        EXPECT_LT(shader.source.find("#version"), shader.source.find("#define"));
+    }
+}
+
+#pragma endregion
+
+#pragma region Shader Materials
+
+TEST(ShaderLibrary, ShaderMaterialIncludesResolveAtRuntime) {
+    auto material = vglx::ShaderMaterial::Create({
+        .vertex_shader = "#version 410 core\n#pragma inject_attributes\n#include \"snippets/vert_global_params.glsl\"\n",
+        .fragment_shader = "#version 410 core\n#pragma inject_attributes\n#include \"snippets/frag_global_params.glsl\"\n"
+    });
+    const auto attrs = make_attributes(material);
+
+    const auto shaders = vglx::ShaderLibrary {}.GetShaderSource(attrs);
+
+    ASSERT_EQ(shaders.size(), 2);
+    for (const auto& shader : shaders) {
+        EXPECT_EQ(shader.source.find("#include"), std::string::npos);
+        EXPECT_NE(shader.source.find("#define NUM_LIGHTS 0\n"), std::string::npos);
+    }
+}
+
+#pragma endregion
@@ -0,0 +1,180 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <vglx/utilities/allocation_tracker.hpp>
+#include <vglx/utilities/stats.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+auto run_frames(vglx::Stats& stats, int count, std::chrono::microseconds frame_time = 200us) {
+    for (auto i = 0; i < count; ++i) {
+        stats.BeforeRender();
+        std::this_thread::sleep_for(frame_time);
+        stats.AfterRender(1);
+    }
+}
+
+}
+
+#pragma region Capture
+
+TEST(Stats, FirstFrameIsNotRecorded) {
+    auto stats = vglx::Stats {};
+    run_frames(stats, 1);
+
+    EXPECT_EQ(stats.GetSummary().frames, 0);
+
+    run_frames(stats, 3);
+
+    EXPECT_EQ(stats.GetSummary().frames, 3);
+}
+
+TEST(Stats, KeepsMostRecentFrames) {
+    auto stats = vglx::Stats {{.capacity = 5}};
+    run_frames(stats, 8);
+
+    const auto samples = stats.GetSamples();
+
+    ASSERT_EQ(samples.size(), 5);
+    EXPECT_EQ(samples.front().frame, 2);
+    EXPECT_EQ(samples.back().frame, 6);
+}
+
+TEST(Stats, Reset) {
+    auto stats = vglx::Stats {};
+    run_frames(stats, 4);
+    stats.Reset();
+
+    EXPECT_EQ(stats.GetSummary().frames, 0);
+    EXPECT_TRUE(stats.GetSamples().empty());
+}
+
+TEST(Stats, RecordsAllocationsPerFrame) {
+    if (!vglx::AllocationTracker::IsEnabled()) {
+        GTEST_SKIP() << "Built without VGLX_TRACK_ALLOCATIONS";
+    }
+
+    auto stats = vglx::Stats {};
+    run_frames(stats, 2);
+
+    stats.BeforeRender();
+    auto allocations = std::vector<std::unique_ptr<int>> {};
+    allocations.reserve(3);
+    for (auto i = 0; i < 3; ++i) allocations.emplace_back(std::make_unique<int>(i));
+    stats.AfterRender(1);
+    run_frames(stats, 1);
+
+    const auto samples = stats.GetSamples();
+
+    ASSERT_EQ(samples.size(), 3);
+    // Like frame time, allocations are attributed when the next frame starts.
+    EXPECT_EQ(samples[2].allocations, 4);
+    EXPECT_EQ(stats.GetSummary().max_allocations, 4);
+}
+
+#pragma endregion
+
+#pragma region Summary
+
+TEST(Stats, PercentilesAreOrdered) {
+    auto stats = vglx::Stats {};
+    run_frames(stats, 20);
+
+    const auto summary = stats.GetSummary();
+
+    EXPECT_GT(summary.p50, 0.0);
+    EXPECT_LE(summary.p50, summary.p95);
+    EXPECT_LE(summary.p95, summary.p99);
+    EXPECT_LE(summary.p99, summary.max);
+}
+
+TEST(Stats, DetectsHitchesAboveThreshold) {
+    auto stats = vglx::Stats {{.hitch_threshold = 20.0, .hitch_ratio = 0.0}};
+    run_frames(stats, 5);
+    run_frames(stats, 1, 30ms);
+    run_frames(stats, 2);
+
+    const auto samples = stats.GetSamples();
+    const auto summary = stats.GetSummary();
+
+    EXPECT_EQ(summary.hitches, 1);
+    EXPECT_GE(summary.max, 20.0);
+    // The slow frame is measured by the interval that ends when the next one starts.
+    EXPECT_TRUE(samples[5].hitch);
+}
+
+TEST(Stats, ReportsAtInterval) {
+    auto stats = vglx::Stats {};
+    auto reports = 0;
+    stats.OnReport([&](const vglx::Stats::Summary&) { ++reports; }, 0.0);
+
+    run_frames(stats, 3);
+
+    EXPECT_EQ(reports, 3);
+}
+
+#pragma endregion
+
+#pragma region Export
+
+TEST(Stats, ToCSV) {
+    auto stats = vglx::Stats {};
+    run_frames(stats, 3);
+
+    const auto csv = stats.ToCSV();
+
+    EXPECT_THAT(csv, ::testing::StartsWith("frame,frame_time_ms,render_time_ms,gpu_time_ms,objects,allocations,hitch\n"));
+    EXPECT_EQ(std::ranges::count(csv, '\n'), 3);
+}
+
+TEST(Stats, ToJSON) {
+    auto stats = vglx::Stats {};
+    run_frames(stats, 3);
+
+    const auto json = stats.ToJSON();
+
+    EXPECT_THAT(json, ::testing::HasSubstr("\"summary\": {\"frames\": 2"));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"p99_ms\""));
+    EXPECT_THAT(json, ::testing::HasSubstr("{\"frame\": 1"));
+}
+
+TEST(Stats, WriteChoosesFormatFromExtension) {
+    auto stats = vglx::Stats {};
+    run_frames(stats, 3);
+
+    const auto path = std::filesystem::temp_directory_path() / "vglx_stats_test.csv";
+    ASSERT_TRUE(stats.Write(path));
+
+    auto file = std::ifstream {path};
+    auto contents = std::stringstream {};
+    contents << file.rdbuf();
+
+    EXPECT_EQ(contents.str(), stats.ToCSV());
+    std::filesystem::remove(path);
+}
+
+TEST(Stats, WriteRejectsUnknownExtension) {
+    auto stats = vglx::Stats {};
+
+    EXPECT_FALSE(stats.Write("stats.txt"));
+}
+
+#pragma endregion
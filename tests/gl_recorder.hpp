@@ -0,0 +1,387 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#pragma once
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Entry points replaced by the recorder, paired with the stub installed for each.
+#define VGLX_GL_RECORDER_CALLS(X) \
+    X(glActiveTexture, Ignored(glad_glActiveTexture)) \
+    X(glAttachShader, Ignored(glad_glAttachShader)) \
+    X(glBindAttribLocation, Ignored(glad_glBindAttribLocation)) \
+    X(glBindBuffer, Counted<&Counts::bind_buffer>(glad_glBindBuffer)) \
+    X(glBindBufferBase, Ignored(glad_glBindBufferBase)) \
+    X(glBindBufferRange, Counted<&Counts::bind_buffer_range>(glad_glBindBufferRange)) \
+    X(glBindTexture, Counted<&Counts::bind_texture>(glad_glBindTexture)) \
+    X(glBindVertexArray, Counted<&Counts::bind_vertex_array>(glad_glBindVertexArray)) \
+    X(glBlendFunc, Ignored(glad_glBlendFunc)) \
+    X(glBufferData, Counted<&Counts::buffer_data>(glad_glBufferData)) \
+    X(glClear, Ignored(glad_glClear)) \
+    X(glClearColor, Ignored(glad_glClearColor)) \
+    X(glCompileShader, CompileShader) \
+    X(glCreateProgram, CreateProgram) \
+    X(glCreateShader, CreateShader) \
+    X(glDeleteBuffers, Ignored(glad_glDeleteBuffers)) \
+    X(glDeleteProgram, Ignored(glad_glDeleteProgram)) \
+    X(glDeleteQueries, Ignored(glad_glDeleteQueries)) \
+    X(glDeleteShader, Ignored(glad_glDeleteShader)) \
+    X(glDeleteTextures, Ignored(glad_glDeleteTextures)) \
+    X(glDeleteVertexArrays, Ignored(glad_glDeleteVertexArrays)) \
+    X(glDepthMask, Ignored(glad_glDepthMask)) \
+    X(glDisable, Counted<&Counts::disable>(glad_glDisable)) \
+    X(glDrawArrays, Counted<&Counts::draw_arrays>(glad_glDrawArrays)) \
+    X(glDrawArraysInstanced, Counted<&Counts::draw_arrays_instanced>(glad_glDrawArraysInstanced)) \
+    X(glDrawElements, Counted<&Counts::draw_elements>(glad_glDrawElements)) \
+    X(glDrawElementsInstanced, Counted<&Counts::draw_elements_instanced>(glad_glDrawElementsInstanced)) \
+    X(glEnable, Counted<&Counts::enable>(glad_glEnable)) \
+    X(glEnableVertexAttribArray, Ignored(glad_glEnableVertexAttribArray)) \
+    X(glFrontFace, Ignored(glad_glFrontFace)) \
+    X(glGenBuffers, GenNames) \
+    X(glGenQueries, GenNames) \
+    X(glGenTextures, GenNames) \
+    X(glGenVertexArrays, GenNames) \
+    X(glGetActiveUniform, GetActiveUniform) \
+    X(glGetActiveUniformBlockName, GetActiveUniformBlockName) \
+    X(glGetError, Ignored(glad_glGetError)) \
+    X(glGetIntegerv, GetIntegerv) \
+    X(glGetProgramBinary, GetProgramBinary) \
+    X(glGetProgramInfoLog, Ignored(glad_glGetProgramInfoLog)) \
+    X(glGetProgramiv, GetProgramiv) \
+    X(glGetQueryObjectiv, GetQueryObjectiv) \
+    X(glGetQueryObjectui64v, GetQueryObjectui64v) \
+    X(glGetShaderInfoLog, Ignored(glad_glGetShaderInfoLog)) \
+    X(glGetShaderiv, GetShaderiv) \
+    X(glGetString, GetString) \
+    X(glGetStringi, GetStringi) \
+    X(glGetUniformLocation, GetUniformLocation) \
+    X(glLinkProgram, LinkProgram) \
+    X(glMapBufferRange, MapBufferRange) \
+    X(glPixelStorei, Ignored(glad_glPixelStorei)) \
+    X(glPolygonMode, Ignored(glad_glPolygonMode)) \
+    X(glPolygonOffset, Ignored(glad_glPolygonOffset)) \
+    X(glProgramBinary, ProgramBinary) \
+    X(glProgramParameteri, Ignored(glad_glProgramParameteri)) \
+    X(glQueryCounter, QueryCounter) \
+    X(glShaderSource, Ignored(glad_glShaderSource)) \
+    X(glTexImage2D, Counted<&Counts::tex_image_2d>(glad_glTexImage2D)) \
+    X(glTexParameteri, Ignored(glad_glTexParameteri)) \
+    X(glUniform1f, Counted<&Counts::uniform>(glad_glUniform1f)) \
+    X(glUniform1i, Counted<&Counts::uniform>(glad_glUniform1i)) \
+    X(glUniform2fv, Counted<&Counts::uniform>(glad_glUniform2fv)) \
+    X(glUniform3fv, Counted<&Counts::uniform>(glad_glUniform3fv)) \
+    X(glUniform4fv, Counted<&Counts::uniform>(glad_glUniform4fv)) \
+    X(glUniformBlockBinding, Ignored(glad_glUniformBlockBinding)) \
+    X(glUniformMatrix3fv, Counted<&Counts::uniform>(glad_glUniformMatrix3fv)) \
+    X(glUniformMatrix4fv, Counted<&Counts::uniform>(glad_glUniformMatrix4fv)) \
+    X(glUnmapBuffer, UnmapBuffer) \
+    X(glUseProgram, Counted<&Counts::use_program>(glad_glUseProgram)) \
+    X(glVertexAttribDivisor, Ignored(glad_glVertexAttribDivisor)) \
+    X(glVertexAttribPointer, Ignored(glad_glVertexAttribPointer)) \
+    X(glViewport, Ignored(glad_glViewport))
+
+/**
+ * Replaces the glad function pointers used by the renderer with stubs that
+ * record calls instead of reaching a driver.
+ *
+ * Glad resolves every entry point into a global function pointer, so swapping
+ * the pointers is enough to run the renderer without a context. Object names
+ * are handed out sequentially, shaders always compile, programs link unless
+ * the test says otherwise, program binaries are a fixed byte pattern, and
+ * buffer maps return scratch memory. Programs report no active uniforms or
+ * uniform blocks unless the test lists them.
+ * Parallel shader compilation can be advertised to exercise pending programs,
+ * in which case programs only report completion once the test allows it.
+ * Calls that matter for batching are counted so tests can lock in the exact
+ * number of state changes a scene produces.
+ *
+ * The recorder must be created before the renderer and destroyed after it,
+ * since the renderer issues GL calls from its constructor and destructor.
+ * The previous pointers are restored on destruction.
+ *
+ * Only a static vglx calls through the pointers linked into the test, so
+ * tests that include this header are not built when vglx is a shared library.
+ */
+class GLRecorder {
+public:
+    struct ActiveUniform {
+        std::string name;
+        GLenum type;
+    };
+
+    struct Counts {
+        std::size_t use_program {0};
+        std::size_t bind_vertex_array {0};
+        std::size_t bind_buffer {0};
+        std::size_t bind_buffer_range {0};
+        std::size_t buffer_data {0};
+        std::size_t bind_texture {0};
+        std::size_t tex_image_2d {0};
+        std::size_t uniform {0};
+        std::size_t compile_shader {0};
+        std::size_t link_program {0};
+        std::size_t program_binary {0};
+        std::size_t enable {0};
+        std::size_t disable {0};
+        std::size_t draw_arrays {0};
+        std::size_t draw_elements {0};
+        std::size_t draw_arrays_instanced {0};
+        std::size_t draw_elements_instanced {0};
+
+        [[nodiscard]] auto DrawCalls() const {
+            return draw_arrays + draw_elements + draw_arrays_instanced + draw_elements_instanced;
+        }
+    };
+
+    GLRecorder() {
+        active_ = this;
+#define X(name, stub) saved_.name##_ = glad_##name; glad_##name = stub;
+        VGLX_GL_RECORDER_CALLS(X)
+#undef X
+    }
+
+    GLRecorder(const GLRecorder&) = delete;
+    GLRecorder& operator=(const GLRecorder&) = delete;
+
+    [[nodiscard]] auto GetCounts() const -> const Counts& { return counts_; }
+
+    auto Reset() -> void { counts_ = {}; }
+
+    /// Scratch memory returned by the most recent buffer map.
+    [[nodiscard]] auto GetMappedBytes() const -> const std::vector<std::byte>& { return mapped_; }
+
+    /// Advertises GL_KHR_parallel_shader_compile to renderers created afterwards.
+    auto SetParallelShaderCompile(bool enabled) -> void { parallel_compile_ = enabled; }
+
+    /// Controls the completion status reported for programs while parallel
+    /// compilation is advertised.
+    auto SetCompilationComplete(bool complete) -> void { compilation_complete_ = complete; }
+
+    /// Uniforms every program reports as active, located at their index.
+    auto SetActiveUniforms(std::vector<ActiveUniform> uniforms) -> void { uniforms_ = std::move(uniforms); }
+
+    /// Uniform blocks every program reports as active.
+    auto SetActiveUniformBlocks(std::vector<std::string> blocks) -> void { blocks_ = std::move(blocks); }
+
+    /// Makes glMapBufferRange fail, as drivers do when out of memory.
+    auto SetMapBufferFails(bool fails) -> void { map_fails_ = fails; }
+
+    /// Controls the link status reported for programs linked from source.
+    auto SetLinkStatus(bool linked) -> void { link_status_ = linked; }
+
+    /// Controls the link status reported for programs restored with
+    /// glProgramBinary, to simulate a driver rejecting a cached binary.
+    auto SetProgramBinaryAccepted(bool accepted) -> void { binary_accepted_ = accepted; }
+
+    ~GLRecorder() {
+#define X(name, stub) glad_##name = saved_.name##_;
+        VGLX_GL_RECORDER_CALLS(X)
+#undef X
+        active_ = nullptr;
+    }
+
+private:
+    template <class T>
+    struct Stub;
+
+    template <class R, class... Args>
+    struct Stub<R (APIENTRY *)(Args...)> {
+        template <std::size_t Counts::* Counter>
+        static auto APIENTRY Count(Args...) -> R {
+            ++(active_->counts_.*Counter);
+            if constexpr (!std::is_void_v<R>) return R {};
+        }
+
+        static auto APIENTRY Ignore(Args...) -> R {
+            if constexpr (!std::is_void_v<R>) return R {};
+        }
+    };
+
+    template <std::size_t Counts::* Counter, class T>
+    static constexpr auto Counted(T) -> T { return &Stub<T>::template Count<Counter>; }
+
+    template <class T>
+    static constexpr auto Ignored(T) -> T { return &Stub<T>::Ignore; }
+
+    static auto APIENTRY GenNames(GLsizei n, GLuint* names) -> void {
+        for (auto i = 0; i < n; ++i) names[i] = ++active_->last_name_;
+    }
+
+    static auto APIENTRY CreateShader(GLenum) -> GLuint {
+        return ++active_->last_name_;
+    }
+
+    static auto APIENTRY CreateProgram() -> GLuint {
+        return ++active_->last_name_;
+    }
+
+    static auto APIENTRY CompileShader(GLuint) -> void {
+        ++active_->counts_.compile_shader;
+    }
+
+    static auto APIENTRY LinkProgram(GLuint) -> void {
+        ++active_->counts_.link_program;
+    }
+
+    static auto APIENTRY GetShaderiv(GLuint, GLenum pname, GLint* params) -> void {
+        *params = pname == GL_COMPILE_STATUS ? GL_TRUE : 0;
+    }
+
+    static auto APIENTRY ProgramBinary(GLuint program, GLenum, const void*, GLsizei) -> void {
+        ++active_->counts_.program_binary;
+        active_->binary_programs_.push_back(program);
+    }
+
+    static auto APIENTRY GetProgramiv(GLuint program, GLenum pname, GLint* params) -> void {
+        switch (pname) {
+            case GL_LINK_STATUS: *params = active_->LinkStatus(program) ? GL_TRUE : GL_FALSE; break;
+            case GL_PROGRAM_BINARY_LENGTH: *params = kProgramBinaryLength; break;
+            case kCompletionStatus: *params = active_->compilation_complete_ ? GL_TRUE : GL_FALSE; break;
+            case GL_ACTIVE_UNIFORMS: *params = static_cast<GLint>(active_->uniforms_.size()); break;
+            case GL_ACTIVE_UNIFORM_MAX_LENGTH: *params = kMaxNameLength; break;
+            case GL_ACTIVE_UNIFORM_BLOCKS: *params = static_cast<GLint>(active_->blocks_.size()); break;
+            case GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH: *params = kMaxNameLength; break;
+            default: *params = 0;
+        }
+    }
+
+    auto LinkStatus(GLuint program) const -> bool {
+        const auto from_binary = std::ranges::find(binary_programs_, program) != binary_programs_.end();
+        return from_binary ? binary_accepted_ : link_status_;
+    }
+
+    static auto APIENTRY GetProgramBinary(
+        GLuint, GLsizei size, GLsizei* length, GLenum* format, void* binary
+    ) -> void {
+        std::memset(binary, 0xAB, static_cast<std::size_t>(size));
+        *length = size;
+        *format = 1;
+    }
+
+    static auto APIENTRY GetIntegerv(GLenum pname, GLint* data) -> void {
+        switch (pname) {
+            case GL_NUM_PROGRAM_BINARY_FORMATS: *data = 1; break;
+            case GL_NUM_EXTENSIONS: *data = active_->parallel_compile_ ? 1 : 0; break;
+            case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT: *data = 256; break;
+            default: *data = 0;
+        }
+    }
+
+    static auto APIENTRY GetString(GLenum) -> const GLubyte* {
+        return reinterpret_cast<const GLubyte*>("GLRecorder");
+    }
+
+    static auto APIENTRY GetStringi(GLenum, GLuint) -> const GLubyte* {
+        return reinterpret_cast<const GLubyte*>("GL_KHR_parallel_shader_compile");
+    }
+
+    static auto APIENTRY GetQueryObjectiv(GLuint, GLenum, GLint* params) -> void {
+        *params = GL_TRUE;
+    }
+
+    // Every timestamp is one millisecond after the previous one
+    static auto APIENTRY QueryCounter(GLuint id, GLenum) -> void {
+        auto& timestamps = active_->timestamps_;
+        if (timestamps.size() <= id) timestamps.resize(id + 1);
+        timestamps[id] = ++active_->clock_ * kTimestampStep;
+    }
+
+    static auto APIENTRY GetQueryObjectui64v(GLuint id, GLenum, GLuint64* params) -> void {
+        const auto& timestamps = active_->timestamps_;
+        *params = id < timestamps.size() ? timestamps[id] : 0;
+    }
+
+    static auto APIENTRY GetActiveUniform(
+        GLuint, GLuint index, GLsizei, GLsizei* length, GLint* size, GLenum* type, GLchar* name
+    ) -> void {
+        const auto& uniform = active_->uniforms_[index];
+        *length = CopyName(uniform.name, name);
+        *size = 1;
+        *type = uniform.type;
+    }
+
+    static auto APIENTRY GetActiveUniformBlockName(
+        GLuint, GLuint index, GLsizei, GLsizei* length, GLchar* name
+    ) -> void {
+        *length = CopyName(active_->blocks_[index], name);
+    }
+
+    static auto APIENTRY GetUniformLocation(GLuint, const GLchar* name) -> GLint {
+        const auto& uniforms = active_->uniforms_;
+        const auto it = std::ranges::find(uniforms, std::string_view {name}, &ActiveUniform::name);
+        return it != uniforms.end() ? static_cast<GLint>(it - uniforms.begin()) : -1;
+    }
+
+    static auto CopyName(const std::string& source, GLchar* name) -> GLsizei {
+        std::memcpy(name, source.c_str(), source.size() + 1);
+        return static_cast<GLsizei>(source.size());
+    }
+
+    static auto APIENTRY MapBufferRange(GLenum, GLintptr, GLsizeiptr length, GLbitfield) -> void* {
+        if (active_->map_fails_) return nullptr;
+        active_->mapped_.resize(static_cast<std::size_t>(length));
+        return active_->mapped_.data();
+    }
+
+    static auto APIENTRY UnmapBuffer(GLenum) -> GLboolean {
+        return GL_TRUE;
+    }
+
+    struct Table {
+#define X(name, stub) decltype(glad_##name) name##_;
+        VGLX_GL_RECORDER_CALLS(X)
+#undef X
+    };
+
+    static constexpr auto kProgramBinaryLength = GLint {64};
+
+    static constexpr auto kMaxNameLength = GLint {64};
+
+    static constexpr auto kTimestampStep = GLuint64 {1'000'000};
+
+    // GL_COMPLETION_STATUS_KHR, missing from the bundled loader.
+    static constexpr auto kCompletionStatus = GLenum {0x91B1};
+
+    static inline GLRecorder* active_ {nullptr};
+
+    Table saved_ {};
+
+    Counts counts_ {};
+
+    std::vector<std::byte> mapped_;
+
+    std::vector<GLuint> binary_programs_;
+
+    std::vector<ActiveUniform> uniforms_;
+
+    std::vector<std::string> blocks_;
+
+    std::vector<GLuint64> timestamps_;
+
+    GLuint64 clock_ {0};
+
+    GLuint last_name_ {0};
+
+    bool parallel_compile_ {false};
+
+    bool compilation_complete_ {true};
+
+    bool link_status_ {true};
+
+    bool binary_accepted_ {true};
+
+    bool map_fails_ {false};
+};
@@ -8,11 +8,14 @@
 #include <gtest/gtest.h>
 #include <test_helpers.hpp>
 
+#include <array>
 #include <cassert>
 #include <limits>
+#include <vector>
 
 #include <vglx/math/box3.hpp>
 #include <vglx/math/matrix4.hpp>
+#include <vglx/math/transform3.hpp>
 #include <vglx/math/vector3.hpp>
 
 #pragma region Constructors
@@ -354,6 +357,109 @@ TEST(Box3, TransformWithRotation) {
 
 #pragma endregion
 
+#pragma region Batch Transform
+
+namespace {
+
+auto make_transform(const vglx::Vector3& position, float angle, const vglx::Vector3& scale) {
+    auto t = vglx::Transform3 {};
+    t.SetPosition(position);
+    t.SetRotation({angle, angle * 0.5f, -angle});
+    t.SetScale(scale);
+    return t.Get();
+}
+
+// Reference bounds computed from all eight transformed corners
+auto corner_bounds(const vglx::Box3& box, const vglx::Matrix4& m) {
+    auto out = vglx::Box3 {};
+    for (auto i = 0; i < 8; ++i) {
+        out.ExpandWithPoint(m * vglx::Vector3 {
+            i & 1 ? box.max.x : box.min.x,
+            i & 2 ? box.max.y : box.min.y,
+            i & 4 ? box.max.z : box.min.z
+        });
+    }
+    return out;
+}
+
+const auto transforms = std::array {
+    make_transform({1.0f, -2.0f, 3.0f}, 0.3f, {1.0f, 2.0f, 0.5f}),
+    make_transform({-5.0f, 0.0f, 2.0f}, 1.2f, {3.0f, 3.0f, 3.0f}),
+    make_transform({0.0f, 4.0f, -1.0f}, -2.1f, {-1.0f, 1.0f, 1.0f})
+};
+
+const auto boxes = std::array {
+    vglx::Box3 {{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+    vglx::Box3 {{0.0f, 2.0f, -3.0f}, {4.0f, 2.5f, 1.0f}},
+    vglx::Box3 {{-2.0f, -0.5f, 0.0f}, {-1.0f, 0.5f, 6.0f}}
+};
+
+}
+
+TEST(Box3, ApplyTransformMatchesCorners) {
+    for (const auto& m : transforms) {
+        for (const auto& box : boxes) {
+            auto b = box;
+            b.ApplyTransform(m);
+            const auto expected = corner_bounds(box, m);
+            EXPECT_VEC3_NEAR(b.min, expected.min, 1e-4f);
+            EXPECT_VEC3_NEAR(b.max, expected.max, 1e-4f);
+        }
+    }
+}
+
+TEST(Box3, ApplyTransformKeepsEmptyBox) {
+    auto b = vglx::Box3 {};
+    b.ApplyTransform(transforms[0]);
+
+    EXPECT_TRUE(b.IsEmpty());
+}
+
+TEST(Box3, BatchApplyTransformOneMatrix) {
+    auto out = std::array<vglx::Box3, 4> {};
+    const auto input = std::array {boxes[0], boxes[1], vglx::Box3 {}, boxes[2]};
+
+    vglx::ApplyTransform(input, transforms[1], out);
+
+    for (auto i = 0; i < out.size(); ++i) {
+        if (input[i].IsEmpty()) {
+            EXPECT_TRUE(out[i].IsEmpty());
+            continue;
+        }
+        const auto expected = corner_bounds(input[i], transforms[1]);
+        EXPECT_VEC3_NEAR(out[i].min, expected.min, 1e-4f);
+        EXPECT_VEC3_NEAR(out[i].max, expected.max, 1e-4f);
+    }
+}
+
+TEST(Box3, BatchApplyTransformPairsInPlace) {
+    auto out = boxes;
+
+    vglx::ApplyTransform(out, transforms, out);
+
+    for (auto i = 0; i < out.size(); ++i) {
+        const auto expected = corner_bounds(boxes[i], transforms[i]);
+        EXPECT_VEC3_NEAR(out[i].min, expected.min, 1e-4f);
+        EXPECT_VEC3_NEAR(out[i].max, expected.max, 1e-4f);
+    }
+}
+
+TEST(Box3, TransformedUnion) {
+    auto expected = vglx::Box3 {};
+    for (const auto& m : transforms) {
+        expected.Union(corner_bounds(boxes[1], m));
+    }
+
+    const auto b = vglx::TransformedUnion(boxes[1], transforms);
+
+    EXPECT_VEC3_NEAR(b.min, expected.min, 1e-4f);
+    EXPECT_VEC3_NEAR(b.max, expected.max, 1e-4f);
+    EXPECT_TRUE(vglx::TransformedUnion(boxes[1], {}).IsEmpty());
+    EXPECT_TRUE(vglx::TransformedUnion(vglx::Box3 {}, transforms).IsEmpty());
+}
+
+#pragma endregion
+
 #pragma region Translate
 
 TEST(Box3, Translate) {
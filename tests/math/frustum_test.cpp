@@ -12,6 +12,10 @@
 #include <vglx/cameras/orthographic_camera.hpp>
 #include <vglx/cameras/perspective_camera.hpp>
 
+#include <cstdint>
+#include <random>
+#include <vector>
+
 #pragma region Fixtures
 
 class FrustumTest : public ::testing::Test {
@@ -127,4 +131,91 @@ TEST_F(FrustumTest, IntersectsWithBox3) {
     static_assert(frustum.IntersectsWithBox3(b2));
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+#pragma region Batch Culling
+
+namespace {
+
+struct SphereArrays {
+    std::vector<float> xs, ys, zs, rs;
+
+    auto Add(const vglx::Sphere& s) {
+        xs.emplace_back(s.center.x);
+        ys.emplace_back(s.center.y);
+        zs.emplace_back(s.center.z);
+        rs.emplace_back(s.radius);
+    }
+};
+
+auto random_spheres(size_t count) {
+    auto engine = std::mt19937 {42};
+    auto position = std::uniform_real_distribution {-150.0f, 150.0f};
+    auto radius = std::uniform_real_distribution {0.1f, 5.0f};
+
+    auto spheres = std::vector<vglx::Sphere> {};
+    for (auto i = 0; i < count; ++i) {
+        spheres.emplace_back(
+            vglx::Vector3 {position(engine), position(engine), position(engine)},
+            radius(engine)
+        );
+    }
+    return spheres;
+}
+
+auto is_visible(const std::vector<uint32_t>& mask, size_t i) {
+    return (mask[i / 32] & (1u << (i % 32))) != 0;
+}
+
+}
+
+TEST_F(FrustumTest, CullSpheresMatchesIntersectsWithSphere) {
+    const auto frustum = vglx::Frustum(perspective_projection);
+
+    // Odd count exercises the scalar tail after the SIMD loop
+    const auto spheres = random_spheres(1003);
+    auto arrays = SphereArrays {};
+    for (const auto& s : spheres) arrays.Add(s);
+
+    auto visible = std::vector<uint32_t>((spheres.size() + 31) / 32, 0xFFFFFFFF);
+    frustum.CullSpheres(arrays.xs, arrays.ys, arrays.zs, arrays.rs, visible);
+
+    auto visible_count = 0;
+    for (auto i = 0; i < spheres.size(); ++i) {
+        EXPECT_EQ(is_visible(visible, i), frustum.IntersectsWithSphere(spheres[i])) << i;
+        visible_count += is_visible(visible, i);
+    }
+    EXPECT_GT(visible_count, 0);
+    EXPECT_EQ(visible.back() >> (spheres.size() % 32), 0);
+}
+
+TEST_F(FrustumTest, CullSpheresWithPlaneCache) {
+    const auto frustum = vglx::Frustum(perspective_projection);
+
+    const auto spheres = random_spheres(257);
+    auto arrays = SphereArrays {};
+    for (const auto& s : spheres) arrays.Add(s);
+
+    auto cache = std::vector<uint8_t>(spheres.size(), 0);
+    auto visible = std::vector<uint32_t>((spheres.size() + 31) / 32);
+
+    // The second pass starts from the cached planes and must agree with the first
+    for (auto pass = 0; pass < 2; ++pass) {
+        frustum.CullSpheres(arrays.xs, arrays.ys, arrays.zs, arrays.rs, visible, cache);
+        for (auto i = 0; i < spheres.size(); ++i) {
+            EXPECT_EQ(is_visible(visible, i), frustum.IntersectsWithSphere(spheres[i])) << i;
+            EXPECT_LT(cache[i], 6);
+        }
+    }
+}
+
+TEST_F(FrustumTest, CullSpheresEmptyInput) {
+    const auto frustum = vglx::Frustum(perspective_projection);
+    auto visible = std::vector<uint32_t> {};
+
+    frustum.CullSpheres({}, {}, {}, {}, visible);
+
+    EXPECT_TRUE(visible.empty());
+}
+
+#pragma endregion
@@ -10,6 +10,7 @@
 
 #include <vglx/math/matrix4.hpp>
 
+#include <array>
 #include <cassert>
 
 #pragma region Constructors
@@ -459,4 +460,121 @@ TEST(Matrix4, CallOperatorReturnsElementsRowMajor) {
     EXPECT_EQ(m(3, 3), 5.0f); static_assert(m(3, 3) == 5.0f);
 }
 
-#pragma endregion
\ No newline at end of file
+#pragma endregion
+
+#pragma region Runtime Kernels
+
+namespace {
+
+constexpr auto kernel_a = vglx::Matrix4 {
+    4.0f, 7.0f, 2.0f, 1.0f,
+    3.0f, 6.0f, 1.0f, 2.0f,
+    2.0f, 5.0f, 3.0f, 3.0f,
+    1.0f, 1.0f, 2.0f, 1.0f
+};
+
+constexpr auto kernel_b = vglx::Matrix4 {
+    0.5f, -1.0f, 0.0f, 2.0f,
+    1.5f, 2.0f, -3.0f, 0.0f,
+    0.0f, 1.0f, 1.0f, -1.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+};
+
+}
+
+TEST(Matrix4, RuntimeMultiplyMatchesConstexpr) {
+    constexpr auto expected = kernel_a * kernel_b;
+    const auto a = kernel_a;
+    const auto b = kernel_b;
+
+    EXPECT_MAT4_NEAR(a * b, expected, 1e-5f);
+}
+
+TEST(Matrix4, RuntimeInverseMatchesConstexpr) {
+    constexpr auto expected_a = vglx::Inverse(kernel_a);
+    constexpr auto expected_b = vglx::Inverse(kernel_b);
+    const auto a = kernel_a;
+    const auto b = kernel_b;
+
+    EXPECT_MAT4_NEAR(vglx::Inverse(a), expected_a, 1e-5f);
+    EXPECT_MAT4_NEAR(vglx::Inverse(b), expected_b, 1e-5f);
+    EXPECT_MAT4_NEAR(vglx::Inverse(a) * a, vglx::Matrix4::Identity(), 1e-5f);
+}
+
+#pragma endregion
+
+#pragma region Batch Operations
+
+TEST(Matrix4, BatchMultiplyPairs) {
+    const auto a = std::array {kernel_a, kernel_b, vglx::Matrix4::Identity()};
+    const auto b = std::array {kernel_b, kernel_a, kernel_a};
+    auto out = std::array<vglx::Matrix4, 3> {};
+
+    vglx::Multiply(a, b, out);
+
+    for (auto i = 0; i < out.size(); ++i) {
+        EXPECT_MAT4_NEAR(out[i], a[i] * b[i], 1e-5f);
+    }
+}
+
+TEST(Matrix4, BatchMultiplyOneByMany) {
+    const auto b = std::array {kernel_a, kernel_b, vglx::Matrix4::Identity()};
+    auto out = std::array<vglx::Matrix4, 3> {};
+
+    vglx::Multiply(kernel_a, b, out);
+
+    for (auto i = 0; i < out.size(); ++i) {
+        EXPECT_MAT4_NEAR(out[i], kernel_a * b[i], 1e-5f);
+    }
+}
+
+TEST(Matrix4, BatchMultiplyInPlace) {
+    auto mats = std::array {kernel_a, kernel_b};
+    const auto expected = std::array {kernel_b * kernel_a, kernel_b * kernel_b};
+
+    vglx::Multiply(kernel_b, mats, mats);
+
+    EXPECT_MAT4_NEAR(mats[0], expected[0], 1e-5f);
+    EXPECT_MAT4_NEAR(mats[1], expected[1], 1e-5f);
+}
+
+TEST(Matrix4, BatchInverse) {
+    const auto mats = std::array {kernel_a, kernel_b};
+    auto out = std::array<vglx::Matrix4, 2> {};
+
+    vglx::Inverse(mats, out);
+
+    EXPECT_MAT4_NEAR(out[0], vglx::Inverse(kernel_a), 1e-5f);
+    EXPECT_MAT4_NEAR(out[1], vglx::Inverse(kernel_b), 1e-5f);
+}
+
+TEST(Matrix4, TransformPointsOneByMany) {
+    const auto points = std::array {
+        vglx::Vector3 {1.0f, 2.0f, 3.0f},
+        vglx::Vector3 {-4.0f, 0.5f, 0.0f},
+        vglx::Vector3::Zero()
+    };
+    auto out = std::array<vglx::Vector3, 3> {};
+
+    vglx::TransformPoints(kernel_a, points, out);
+
+    for (auto i = 0; i < out.size(); ++i) {
+        EXPECT_VEC3_NEAR(out[i], kernel_a * points[i], 1e-4f);
+    }
+}
+
+TEST(Matrix4, TransformPointsPairs) {
+    const auto mats = std::array {kernel_a, kernel_b};
+    auto points = std::array {
+        vglx::Vector3 {1.0f, 2.0f, 3.0f},
+        vglx::Vector3 {-4.0f, 0.5f, 0.0f}
+    };
+    const auto expected = std::array {kernel_a * points[0], kernel_b * points[1]};
+
+    vglx::TransformPoints(mats, points, points);
+
+    EXPECT_VEC3_NEAR(points[0], expected[0], 1e-4f);
+    EXPECT_VEC3_NEAR(points[1], expected[1], 1e-4f);
+}
+
+#pragma endregion
@@ -0,0 +1,146 @@
+/*
+===========================================================================
+  VGLX https://vglx.org
+  Copyright © 2024 - Present, Shlomi Nissan
+===========================================================================
+*/
+
+#include <gtest/gtest.h>
+#include <test_helpers.hpp>
+
+#include <vglx/math/euler.hpp>
+#include <vglx/math/matrix4.hpp>
+#include <vglx/math/quaternion.hpp>
+#include <vglx/math/utilities.hpp>
+#include <vglx/math/vector3.hpp>
+
+#pragma region Helpers
+
+auto EXPECT_QUAT_NEAR(const vglx::Quaternion& a, const vglx::Quaternion& b, float v) -> void {
+    // q and -q describe the same rotation
+    const auto sign = vglx::Dot(a, b) < 0.0f ? -1.0f : 1.0f;
+    EXPECT_NEAR(a.x, b.x * sign, v);
+    EXPECT_NEAR(a.y, b.y * sign, v);
+    EXPECT_NEAR(a.z, b.z * sign, v);
+    EXPECT_NEAR(a.w, b.w * sign, v);
+}
+
+#pragma endregion
+
+#pragma region Constructors
+
+TEST(Quaternion, DefaultConstructor) {
+    constexpr auto q = vglx::Quaternion {};
+
+    static_assert(q.IsIdentity());
+    EXPECT_MAT4_EQ(q.GetMatrix(), vglx::Matrix4 {1.0f});
+}
+
+TEST(Quaternion, ConstructorFromEuler) {
+    const auto e = vglx::Euler {0.5f, -1.2f, 2.3f};
+    const auto q = vglx::Quaternion {e};
+
+    EXPECT_NEAR(q.LengthSquared(), 1.0f, 1e-4f);
+    EXPECT_MAT4_NEAR(q.GetMatrix(), e.GetMatrix(), 1e-4f);
+}
+
+TEST(Quaternion, ConstructorFromMatrix) {
+    // Covers the trace and each diagonal branch
+    const auto eulers = {
+        vglx::Euler {0.1f, 0.2f, 0.3f},
+        vglx::Euler {0.0f, 0.0f, vglx::math::pi - 0.1f},
+        vglx::Euler {vglx::math::pi - 0.1f, 0.0f, 0.0f},
+        vglx::Euler {0.0f, vglx::math::pi - 0.1f, 0.0f}
+    };
+
+    for (const auto& e : eulers) {
+        const auto m = e.GetMatrix();
+        EXPECT_MAT4_NEAR(vglx::Quaternion {m}.GetMatrix(), m, 1e-4f);
+    }
+}
+
+#pragma endregion
+
+#pragma region Operations
+
+TEST(Quaternion, FromAxisAngle) {
+    const auto q = vglx::Quaternion::FromAxisAngle(vglx::Vector3::Up(), vglx::math::pi_over_2);
+
+    EXPECT_VEC3_NEAR(q * vglx::Vector3::Forward(), vglx::Vector3::Right(), 1e-4f);
+}
+
+TEST(Quaternion, MultiplyComposesRotations) {
+    const auto a = vglx::Quaternion {vglx::Euler {0.3f, 0.0f, 0.0f}};
+    const auto b = vglx::Quaternion {vglx::Euler {0.0f, 0.0f, 1.1f}};
+
+    EXPECT_MAT4_NEAR((a * b).GetMatrix(), a.GetMatrix() * b.GetMatrix(), 1e-4f);
+}
+
+TEST(Quaternion, RotateVector) {
+    const auto q = vglx::Quaternion {vglx::Euler {0.4f, -0.7f, 1.3f}};
+    const auto v = vglx::Vector3 {1.0f, -2.0f, 3.0f};
+
+    EXPECT_VEC3_NEAR(q * v, q.GetMatrix() * v, 1e-4f);
+}
+
+TEST(Quaternion, Conjugate) {
+    const auto q = vglx::Quaternion {vglx::Euler {0.4f, -0.7f, 1.3f}};
+
+    EXPECT_QUAT_NEAR(q * q.Conjugate(), vglx::Quaternion::Identity(), 1e-4f);
+}
+
+TEST(Quaternion, Normalize) {
+    auto q = vglx::Quaternion {1.0f, 2.0f, 3.0f, 4.0f};
+    q.Normalize();
+
+    EXPECT_NEAR(q.LengthSquared(), 1.0f, 1e-4f);
+
+    auto zero = vglx::Quaternion {0.0f, 0.0f, 0.0f, 0.0f};
+    zero.Normalize();
+
+    EXPECT_TRUE(zero.IsIdentity());
+}
+
+TEST(Quaternion, GetEuler) {
+    const auto e = vglx::Euler {0.5f, -0.2f, 0.3f};
+    const auto q = vglx::Quaternion {e};
+
+    const auto result = q.GetEuler();
+
+    EXPECT_NEAR(result.pitch, e.pitch, 1e-3f);
+    EXPECT_NEAR(result.yaw, e.yaw, 1e-3f);
+    EXPECT_NEAR(result.roll, e.roll, 1e-3f);
+}
+
+#pragma endregion
+
+#pragma region Interpolation
+
+TEST(Quaternion, SlerpEndpoints) {
+    const auto a = vglx::Quaternion {vglx::Euler {0.0f, 0.2f, 0.0f}};
+    const auto b = vglx::Quaternion {vglx::Euler {0.0f, 1.8f, 0.0f}};
+
+    EXPECT_QUAT_NEAR(vglx::Slerp(a, b, 0.0f), a, 1e-4f);
+    EXPECT_QUAT_NEAR(vglx::Slerp(a, b, 1.0f), b, 1e-4f);
+}
+
+TEST(Quaternion, SlerpMidpoint) {
+    const auto a = vglx::Quaternion::FromAxisAngle(vglx::Vector3::Up(), 0.2f);
+    const auto b = vglx::Quaternion::FromAxisAngle(vglx::Vector3::Up(), 1.8f);
+
+    EXPECT_QUAT_NEAR(
+        vglx::Slerp(a, b, 0.5f),
+        vglx::Quaternion::FromAxisAngle(vglx::Vector3::Up(), 1.0f),
+        1e-4f
+    );
+}
+
+TEST(Quaternion, SlerpShortestArc) {
+    const auto a = vglx::Quaternion::FromAxisAngle(vglx::Vector3::Up(), 0.1f);
+    const auto b = vglx::Quaternion::FromAxisAngle(vglx::Vector3::Up(), 0.3f);
+    const auto negated_b = vglx::Quaternion {-b.x, -b.y, -b.z, -b.w};
+
+    EXPECT_QUAT_NEAR(vglx::Slerp(a, negated_b, 0.5f), vglx::Slerp(a, b, 0.5f), 1e-4f);
+}
+
+#pragma endregion
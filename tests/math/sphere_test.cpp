@@ -12,6 +12,7 @@
 #include <vglx/math/sphere.hpp>
 #include <vglx/math/vector3.hpp>
 
+#include <array>
 #include <cassert>
 
 #pragma region Constructors
@@ -256,6 +257,74 @@ TEST(Sphere, TransformWithRotation) {
 
 #pragma endregion
 
+#pragma region Batch Transform
+
+namespace {
+
+const auto transforms = std::array {
+    vglx::Matrix4 {
+        2.0f, 0.0f, 0.0f, 1.0f,
+        0.0f, 1.0f, 0.0f, -2.0f,
+        0.0f, 0.0f, 3.0f, 0.5f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    },
+    vglx::Matrix4 {
+        0.0f, -1.0f, 0.0f, 4.0f,
+        1.0f,  0.0f, 0.0f, 0.0f,
+        0.0f,  0.0f, 1.0f, 0.0f,
+        0.0f,  0.0f, 0.0f, 1.0f
+    }
+};
+
+const auto spheres = std::array {
+    vglx::Sphere {{1.0f, 2.0f, 3.0f}, 1.0f},
+    vglx::Sphere {{-1.0f, 0.0f, 0.5f}, 2.5f}
+};
+
+auto transformed(vglx::Sphere s, const vglx::Matrix4& m) {
+    s.ApplyTransform(m);
+    return s;
+}
+
+}
+
+TEST(Sphere, BatchApplyTransformOneMatrix) {
+    auto out = std::array<vglx::Sphere, 2> {};
+
+    vglx::ApplyTransform(spheres, transforms[0], out);
+
+    for (auto i = 0; i < out.size(); ++i) {
+        const auto expected = transformed(spheres[i], transforms[0]);
+        EXPECT_VEC3_NEAR(out[i].center, expected.center, 1e-5f);
+        EXPECT_NEAR(out[i].radius, expected.radius, 1e-5f);
+    }
+}
+
+TEST(Sphere, BatchApplyTransformPairsInPlace) {
+    auto out = spheres;
+
+    vglx::ApplyTransform(out, transforms, out);
+
+    for (auto i = 0; i < out.size(); ++i) {
+        const auto expected = transformed(spheres[i], transforms[i]);
+        EXPECT_VEC3_NEAR(out[i].center, expected.center, 1e-5f);
+        EXPECT_NEAR(out[i].radius, expected.radius, 1e-5f);
+    }
+}
+
+TEST(Sphere, TransformedUnion) {
+    auto expected = transformed(spheres[0], transforms[0]);
+    expected.Union(transformed(spheres[0], transforms[1]));
+
+    const auto s = vglx::TransformedUnion(spheres[0], transforms);
+
+    EXPECT_VEC3_NEAR(s.center, expected.center, 1e-5f);
+    EXPECT_NEAR(s.radius, expected.radius, 1e-5f);
+    EXPECT_TRUE(vglx::TransformedUnion(vglx::Sphere {}, transforms).IsEmpty());
+}
+
+#pragma endregion
+
 #pragma region Translate
 
 TEST(Sphere, Translate) {
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 #include <test_helpers.hpp>
 
+#include <vglx/math/quaternion.hpp>
 #include <vglx/math/transform3.hpp>
 #include <vglx/math/utilities.hpp>
 
@@ -64,10 +65,8 @@ TEST(Transform3, SetRotation) {
     auto p = vglx::math::pi_over_2;
     t1.SetRotation(vglx::Euler {p + 0.1f, p + 0.2f, p + 0.3f});
 
-    const auto rotation = t1.rotation;
-    EXPECT_NEAR(rotation.pitch, p + 0.1f, 0.0001f);
-    EXPECT_NEAR(rotation.yaw, p + 0.2f, 0.0001f);
-    EXPECT_NEAR(rotation.roll, p + 0.3f, 0.0001f);
+    const auto rotation = vglx::Euler {p + 0.1f, p + 0.2f, p + 0.3f};
+    EXPECT_EQ(t1.rotation, vglx::Quaternion {rotation});
 
     const auto cos_p = vglx::math::Cos(rotation.pitch);
     const auto sin_p = vglx::math::Sin(rotation.pitch);
@@ -76,12 +75,12 @@ TEST(Transform3, SetRotation) {
     const auto cos_r = vglx::math::Cos(rotation.roll);
     const auto sin_r = vglx::math::Sin(rotation.roll);
 
-    EXPECT_MAT4_EQ(t1.Get(), {
+    EXPECT_MAT4_NEAR(t1.Get(), {
         cos_r * cos_y - sin_r * sin_p * sin_y, -sin_r * cos_p, cos_r * sin_y + sin_r * sin_p * cos_y, 0.0f,
         sin_r * cos_y + cos_r * sin_p * sin_y, cos_r * cos_p, sin_r * sin_y - cos_r * sin_p * cos_y, 0.0f,
         -cos_p * sin_y, sin_p, cos_p * cos_y, 0.0f,
         0.0f, 0.0f, 0.0f, 1.0f
-    });
+    }, 1e-4f);
 
     constexpr auto t2 = []() {
         auto t = vglx::Transform3 {};
@@ -95,13 +94,13 @@ TEST(Transform3, MultipleTransformations) {
     auto t = vglx::Transform3 {};
     t.SetPosition({2.0f, 1.0f, 3.0f});
     t.SetScale({2.0f, 1.0f, 3.0f});
-    t.SetRotation(vglx::Euler {
+    const auto rotation = vglx::Euler {
         vglx::math::pi_over_2 + 0.1f,
         vglx::math::pi_over_2 + 0.2f,
         vglx::math::pi_over_2 + 0.3f
-    });
+    };
+    t.SetRotation(rotation);
 
-    const auto& rotation = t.rotation;
     const auto& position = t.position;
     const auto& scale = t.scale;
     const auto cos_p = vglx::math::Cos(rotation.pitch);
@@ -111,7 +110,7 @@ TEST(Transform3, MultipleTransformations) {
     const auto cos_r = vglx::math::Cos(rotation.roll);
     const auto sin_r = vglx::math::Sin(rotation.roll);
 
-    EXPECT_MAT4_EQ(t.Get(), {
+    EXPECT_MAT4_NEAR(t.Get(), {
         scale.x * (cos_r * cos_y - sin_r * sin_p * sin_y),
         scale.y * (-sin_r * cos_p),
         scale.z * (cos_r * sin_y + sin_r * sin_p * cos_y),
@@ -128,7 +127,7 @@ TEST(Transform3, MultipleTransformations) {
         position.z,
 
         0.0f, 0.0f, 0.0f, 1.0f
-    });
+    }, 1e-4f);
 }
 
 #pragma endregion
@@ -193,12 +192,12 @@ TEST(Transform3, RotateX) {
     constexpr auto c = vglx::math::Cos(vglx::math::pi_over_2 + 0.1f);
     constexpr auto s = vglx::math::Sin(vglx::math::pi_over_2 + 0.1f);
 
-    EXPECT_MAT4_EQ(t.Get(), {
+    EXPECT_MAT4_NEAR(t.Get(), {
         1.0f, 0.0f, 0.0f, 0.0f,
         0.0f, c, -s, 0.0f,
         0.0f, s, c, 0.0f,
         0.0f, 0.0f, 0.0f, 1.0f
-    });
+    }, 1e-4f);
 
     constexpr auto m = []() {
         auto t = vglx::Transform3 {};
@@ -207,10 +206,10 @@ TEST(Transform3, RotateX) {
         return t.Get();
     }();
 
-    static_assert(m[1].y == c);
-    static_assert(m[1].z == s);
-    static_assert(m[2].y == -s);
-    static_assert(m[2].z == c);
+    static_assert(ApproxEqual(m[1].y, c));
+    static_assert(ApproxEqual(m[1].z, s));
+    static_assert(ApproxEqual(m[2].y, -s));
+    static_assert(ApproxEqual(m[2].z, c));
 }
 
 TEST(Transform3, RotateY) {
@@ -221,12 +220,12 @@ TEST(Transform3, RotateY) {
     constexpr auto c = vglx::math::Cos(vglx::math::pi_over_2 + 0.1f);
     constexpr auto s = vglx::math::Sin(vglx::math::pi_over_2 + 0.1f);
 
-    EXPECT_MAT4_EQ(t.Get(), {
+    EXPECT_MAT4_NEAR(t.Get(), {
         c, 0.0f, s, 0.0f,
         0.0f, 1.0f, 0.0f, 0.0f,
         -s, 0.0f, c, 0.0f,
         0.0f, 0.0f, 0.0f, 1.0f
-    });
+    }, 1e-4f);
 
     constexpr auto m = []() {
         auto t = vglx::Transform3 {};
@@ -235,10 +234,10 @@ TEST(Transform3, RotateY) {
         return t.Get();
     }();
 
-    static_assert(m[0].x == c);
-    static_assert(m[0].z == -s);
-    static_assert(m[2].x == s);
-    static_assert(m[2].z == c);
+    static_assert(ApproxEqual(m[0].x, c));
+    static_assert(ApproxEqual(m[0].z, -s));
+    static_assert(ApproxEqual(m[2].x, s));
+    static_assert(ApproxEqual(m[2].z, c));
 }
 
 TEST(Transform3, RotateZ) {
@@ -249,12 +248,12 @@ TEST(Transform3, RotateZ) {
     constexpr auto c = vglx::math::Cos(vglx::math::pi_over_2 + 0.1f);
     constexpr auto s = vglx::math::Sin(vglx::math::pi_over_2 + 0.1f);
 
-    EXPECT_MAT4_EQ(t.Get(), {
+    EXPECT_MAT4_NEAR(t.Get(), {
         c, -s, 0.0f, 0.0f,
         s, c, 0.0f, 0.0f,
         0.0f, 0.0f, 1.0f, 0.0f,
         0.0f, 0.0f, 0.0f, 1.0f
-    });
+    }, 1e-4f);
 
     constexpr auto m = []() {
         auto t = vglx::Transform3 {};
@@ -263,10 +262,10 @@ TEST(Transform3, RotateZ) {
         return t.Get();
     }();
 
-    static_assert(m[0].x == c);
-    static_assert(m[0].y == s);
-    static_assert(m[1].x == -s);
-    static_assert(m[1].y == c);
+    static_assert(ApproxEqual(m[0].x, c));
+    static_assert(ApproxEqual(m[0].y, s));
+    static_assert(ApproxEqual(m[1].x, -s));
+    static_assert(ApproxEqual(m[1].y, c));
 }
 
 #pragma endregion
@@ -278,12 +277,12 @@ TEST(Transform3, TranslateBeforeRotation) {
     t.Translate({0.0f, 0.0f, 1.0f});
     t.Rotate(vglx::Vector3::Up(), vglx::math::pi_over_2);
 
-    EXPECT_MAT4_EQ(t.Get(), {
+    EXPECT_MAT4_NEAR(t.Get(), {
          0.0f, 0.0f, 1.0f, 0.0f,
          0.0f, 1.0f, 0.0f, 0.0f,
         -1.0f, 0.0f, 0.0f, 1.0f,
          0.0f, 0.0f, 0.0f, 1.0f
-    });
+    }, 1e-4f);
 
     constexpr auto m = []() {
         auto t = vglx::Transform3 {};
@@ -292,18 +291,18 @@ TEST(Transform3, TranslateBeforeRotation) {
         return t.Get();
     }();
 
-    static_assert(m[0].x == 0.0f);
-    static_assert(m[0].y == 0.0f);
-    static_assert(m[0].z == -1.0f);
-    static_assert(m[1].x == 0.0f);
-    static_assert(m[1].y == 1.0f);
-    static_assert(m[1].z == 0.0f);
-    static_assert(m[2].x == 1.0f);
-    static_assert(m[2].y == 0.0f);
-    static_assert(m[2].z == 0.0f);
-    static_assert(m[3].x == 0.0f);
-    static_assert(m[3].y == 0.0f);
-    static_assert(m[3].z == 1.0f);
+    static_assert(ApproxEqual(m[0].x, 0.0f));
+    static_assert(ApproxEqual(m[0].y, 0.0f));
+    static_assert(ApproxEqual(m[0].z, -1.0f));
+    static_assert(ApproxEqual(m[1].x, 0.0f));
+    static_assert(ApproxEqual(m[1].y, 1.0f));
+    static_assert(ApproxEqual(m[1].z, 0.0f));
+    static_assert(ApproxEqual(m[2].x, 1.0f));
+    static_assert(ApproxEqual(m[2].y, 0.0f));
+    static_assert(ApproxEqual(m[2].z, 0.0f));
+    static_assert(ApproxEqual(m[3].x, 0.0f));
+    static_assert(ApproxEqual(m[3].y, 0.0f));
+    static_assert(ApproxEqual(m[3].z, 1.0f));
 }
 
 TEST(Transform3, TranslateAfterRotation) {
@@ -311,12 +310,12 @@ TEST(Transform3, TranslateAfterRotation) {
     t.Rotate(vglx::Vector3::Up(), vglx::math::pi_over_2);
     t.Translate({0.0f, 0.0f, 1.0f});
 
-    EXPECT_MAT4_EQ(t.Get(), {
+    EXPECT_MAT4_NEAR(t.Get(), {
          0.0f, 0.0f, 1.0f, 1.0f,
          0.0f, 1.0f, 0.0f, 0.0f,
         -1.0f, 0.0f, 0.0f, 0.0f,
          0.0f, 0.0f, 0.0f, 1.0f
-    });
+    }, 1e-4f);
 
     constexpr auto m = []() {
         auto t = vglx::Transform3 {};
@@ -325,18 +324,67 @@ TEST(Transform3, TranslateAfterRotation) {
         return t.Get();
     }();
 
-    static_assert(m[0].x == 0.0f);
-    static_assert(m[0].y == 0.0f);
-    static_assert(m[0].z == -1.0f);
-    static_assert(m[1].x == 0.0f);
-    static_assert(m[1].y == 1.0f);
-    static_assert(m[1].z == 0.0f);
-    static_assert(m[2].x == 1.0f);
-    static_assert(m[2].y == 0.0f);
-    static_assert(m[2].z == 0.0f);
-    static_assert(m[3].x == 1.0f);
-    static_assert(m[3].y == 0.0f);
-    static_assert(m[3].z == 0.0f);
+    static_assert(ApproxEqual(m[0].x, 0.0f));
+    static_assert(ApproxEqual(m[0].y, 0.0f));
+    static_assert(ApproxEqual(m[0].z, -1.0f));
+    static_assert(ApproxEqual(m[1].x, 0.0f));
+    static_assert(ApproxEqual(m[1].y, 1.0f));
+    static_assert(ApproxEqual(m[1].z, 0.0f));
+    static_assert(ApproxEqual(m[2].x, 1.0f));
+    static_assert(ApproxEqual(m[2].y, 0.0f));
+    static_assert(ApproxEqual(m[2].z, 0.0f));
+    static_assert(ApproxEqual(m[3].x, 1.0f));
+    static_assert(ApproxEqual(m[3].y, 0.0f));
+    static_assert(ApproxEqual(m[3].z, 0.0f));
+}
+
+#pragma endregion
+
+#pragma region Cached Matrix
+
+TEST(Transform3, RotateArbitraryAxis) {
+    const auto axis = vglx::Normalize({1.0f, 1.0f, 0.0f});
+    auto t = vglx::Transform3 {};
+    t.Rotate(axis, 0.4f);
+    t.Rotate(axis, 0.6f);
+
+    EXPECT_MAT4_NEAR(t.Get(), vglx::Quaternion::FromAxisAngle(axis, 1.0f).GetMatrix(), 1e-4f);
 }
 
-#pragma endregion
\ No newline at end of file
+TEST(Transform3, PositionUpdateKeepsBasis) {
+    auto t = vglx::Transform3 {};
+    t.SetRotation(vglx::Euler {0.3f, 0.5f, -0.2f});
+    t.SetScale({2.0f, 3.0f, 4.0f});
+    const auto before = t.Get();
+
+    t.SetPosition({1.0f, 2.0f, 3.0f});
+    auto expected = before;
+    expected[3] = {1.0f, 2.0f, 3.0f, 1.0f};
+
+    EXPECT_MAT4_EQ(t.Get(), expected);
+}
+
+TEST(Transform3, ScaleUpdateAfterRotation) {
+    const auto rotation = vglx::Euler {0.3f, 0.5f, -0.2f};
+    auto t = vglx::Transform3 {};
+    t.SetRotation(rotation);
+    static_cast<void>(t.Get());
+
+    t.SetScale({2.0f, 2.0f, 2.0f});
+
+    auto expected = t.rotation.GetMatrix();
+    expected[0] *= 2.0f;
+    expected[1] *= 2.0f;
+    expected[2] *= 2.0f;
+    EXPECT_MAT4_NEAR(t.Get(), expected, 1e-5f);
+}
+
+TEST(Transform3, LookAt) {
+    auto t = vglx::Transform3 {};
+    t.LookAt(vglx::Vector3::Zero(), {1.0f, 0.0f, 0.0f}, vglx::Vector3::Up());
+
+    EXPECT_VEC3_NEAR(t.rotation * vglx::Vector3::Forward(), vglx::Vector3::Right(), 1e-4f);
+    EXPECT_VEC3_NEAR(t.rotation * vglx::Vector3::Up(), vglx::Vector3::Up(), 1e-4f);
+}
+
+#pragma endregion
@@ -10,7 +10,9 @@
 #include "test_helpers.hpp"
 
 #include <cassert>
+#include <cmath>
 #include <regex>
+#include <vector>
 
 #include <vglx/math/utilities.hpp>
 
@@ -277,6 +279,67 @@ TEST(MathUtilities, AtanMonotonicity) {
 
 #pragma endregion
 
+#pragma region Array Forms
+
+namespace {
+
+// Odd length so the scalar tail is exercised
+auto make_inputs(float lo, float hi) {
+    auto values = std::vector<float>(37);
+    for (auto i = 0uz; i < values.size(); ++i) {
+        values[i] = math::Lerp(lo, hi, static_cast<float>(i) / (values.size() - 1));
+    }
+    return values;
+}
+
+}
+
+TEST(MathUtilities, SinCosArrayMatchesScalar) {
+    const auto x = make_inputs(-20.0f, 20.0f);
+    auto sin = std::vector<float>(x.size());
+    auto cos = std::vector<float>(x.size());
+
+    math::SinCos(x, sin, cos);
+
+    for (auto i = 0uz; i < x.size(); ++i) {
+        EXPECT_NEAR(sin[i], math::Sin(x[i]), 1e-6f);
+        EXPECT_NEAR(cos[i], math::Cos(x[i]), 1e-6f);
+        EXPECT_NEAR(sin[i], std::sin(x[i]), 1e-4f);
+        EXPECT_NEAR(cos[i], std::cos(x[i]), 1e-4f);
+    }
+}
+
+TEST(MathUtilities, SinCosArrayInPlace) {
+    const auto x = make_inputs(-math::pi, math::pi);
+    auto sin = x;
+    auto cos = x;
+
+    math::Sin(sin, sin);
+    math::Cos(cos, cos);
+
+    for (auto i = 0uz; i < x.size(); ++i) {
+        EXPECT_NEAR(sin[i], math::Sin(x[i]), 1e-6f);
+        EXPECT_NEAR(cos[i], math::Cos(x[i]), 1e-6f);
+    }
+}
+
+TEST(MathUtilities, AtanArrayMatchesScalar) {
+    auto x = make_inputs(-8.0f, 8.0f);
+    x.push_back(std::numeric_limits<float>::infinity());
+    x.push_back(-1e6f);
+    x.push_back(1.0f);
+    auto out = std::vector<float>(x.size());
+
+    math::Atan(x, out);
+
+    for (auto i = 0uz; i < x.size(); ++i) {
+        EXPECT_NEAR(out[i], math::Atan(x[i]), 1e-6f);
+        EXPECT_NEAR(out[i], std::atan(x[i]), 1e-4f);
+    }
+}
+
+#pragma endregion
+
 #pragma region Atan2
 
 TEST(MathUtilities, Atan2CommonAngles) {
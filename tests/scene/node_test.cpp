@@ -46,6 +46,66 @@ TEST(Node, RemoveAllChildren) {
     EXPECT_TRUE(parent->Children().empty());
 }
 
+TEST(Node, RemoveChildPreservesOrder) {
+    auto parent = vglx::Node::Create();
+    parent->preserve_child_order = true;
+    auto child1 = vglx::Node::Create();
+    auto child2 = vglx::Node::Create();
+    auto child3 = vglx::Node::Create();
+
+    parent->Add(child1);
+    parent->Add(child2);
+    parent->Add(child3);
+    parent->Remove(child1);
+
+    ASSERT_EQ(parent->Children().size(), 2);
+    EXPECT_EQ(parent->Children()[0], child2);
+    EXPECT_EQ(parent->Children()[1], child3);
+
+    parent->Remove(child3);
+    parent->Remove(child2);
+
+    EXPECT_TRUE(parent->Children().empty());
+}
+
+TEST(Node, RemoveChildUnordered) {
+    auto parent = vglx::Node::Create();
+
+    auto children = std::vector<std::shared_ptr<vglx::Node>> {};
+    for (auto i = 0; i < 8; ++i) {
+        children.emplace_back(vglx::Node::Create());
+        parent->Add(children.back());
+    }
+
+    parent->Remove(children[0]);
+    parent->Remove(children[3]);
+    parent->Remove(children[7]);
+
+    EXPECT_EQ(parent->Children().size(), 5);
+    for (auto i : {1, 2, 4, 5, 6}) {
+        EXPECT_EQ(children[i]->Parent(), parent.get());
+    }
+
+    // Removal must keep the stored indices of the moved children valid
+    for (auto i : {6, 1, 5, 2, 4}) {
+        parent->Remove(children[i]);
+        EXPECT_EQ(children[i]->Parent(), nullptr);
+    }
+
+    EXPECT_TRUE(parent->Children().empty());
+}
+
+TEST(Node, RemoveChildByChildrenReference) {
+    auto parent = vglx::Node::Create();
+    parent->Add(vglx::Node::Create());
+    parent->Add(vglx::Node::Create());
+
+    parent->Remove(parent->Children()[0]);
+    parent->Remove(parent->Children()[0]);
+
+    EXPECT_TRUE(parent->Children().empty());
+}
+
 #pragma endregion
 
 #pragma region Hierarchy Queries
@@ -195,6 +255,22 @@ TEST(Node, AddChildWithExistingParent) {
     EXPECT_EQ(child->Parent(), parent2.get());
 }
 
+TEST(Node, ReparentChildKeepsSiblingsValid) {
+    auto parent1 = vglx::Node::Create();
+    auto parent2 = vglx::Node::Create();
+    auto child1 = vglx::Node::Create();
+    auto child2 = vglx::Node::Create();
+
+    parent1->Add(child1);
+    parent1->Add(child2);
+    parent2->Add(child1);
+    parent1->Remove(child2);
+
+    EXPECT_TRUE(parent1->Children().empty());
+    EXPECT_EQ(parent2->Children().size(), 1);
+    EXPECT_EQ(child2->Parent(), nullptr);
+}
+
 TEST(Node, RemoveNonexistentChild) {
     auto parent = vglx::Node::Create();
     auto child = vglx::Node::Create();